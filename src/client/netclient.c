@@ -2401,14 +2401,73 @@ static int Receive_show_floor(void)
 }
 
 
+/*
+ * Check if a grid of the map can be drawn on the main screen
+ */
+static bool map_grid_drawable(byte x, byte y)
+{
+    byte x_off = x + COL_MAP;
+    bool draw = true;
+
+    if (player->screen_save_depth || section_icky_row || store_ctx) draw = false;
+    if (section_icky_row)
+    {
+        if (y >= section_icky_row) draw = true;
+        else if ((section_icky_col > 0) && (x_off >= section_icky_col)) draw = true;
+        else if ((section_icky_col < 0) && (x_off >= 0 - section_icky_col)) draw = true;
+    }
+
+    return draw;
+}
+
+
+/*
+ * Draw a grid of the map on the main screen
+ */
+static void map_grid_draw(byte x, byte y, u16b a, char c, u16b ta, char tc)
+{
+    byte x_off = x + COL_MAP + x * (tile_width - 1);
+
+    y = (y - 1) * tile_height + 1;
+
+    Term_queue_char_safe(x_off, y, a, c, ta, tc);
+    if (tile_width * tile_height > 1)
+    {
+        u16b a_dummy = (use_graphics? COLOUR_WHITE: 0);
+        char c_dummy = (use_graphics? ' ': 0);
+
+        Term_big_queue_char_safe(x_off, y, a, c, a_dummy, c_dummy);
+    }
+}
+
+
+/*
+ * Restore a grid of the map from the screen memory
+ */
+static void map_grid_restore(byte x, byte y)
+{
+    u16b ta = 0;
+    char tc = 0;
+
+    if (!map_grid_drawable(x, y)) return;
+
+    if (use_graphics)
+    {
+        ta = player->trn_info[y][x].a;
+        tc = player->trn_info[y][x].c;
+    }
+
+    map_grid_draw(x, y, player->scr_info[y][x].a, player->scr_info[y][x].c, ta, tc);
+}
+
+
 static int Receive_char(void)
 {
     int n;
     byte ch;
-    byte x, y, x_off;
+    byte x, y;
     char c, tcp;
     u16b a, tap;
-    bool draw = true;
     int bytes_read;
 
     tap = tcp = c = a = x = y = 0;
@@ -2452,31 +2511,8 @@ static int Receive_char(void)
         player->trn_info[y][x].c = tcp;
     }
 
-    /* Hack -- manipulate offset */
-    x_off = x + COL_MAP;
-
-    if (player->screen_save_depth || section_icky_row || store_ctx) draw = false;
-    if (section_icky_row)
-    {
-        if (y >= section_icky_row) draw = true;
-        else if ((section_icky_col > 0) && (x_off >= section_icky_col)) draw = true;
-        else if ((section_icky_col < 0) && (x_off >= 0 - section_icky_col)) draw = true;
-    }
-
-    if (draw)
-    {
-        x_off += x * (tile_width - 1);
-        y = (y - 1) * tile_height + 1;
-
-        Term_queue_char_safe(x_off, y, a, c, tap, tcp);
-        if (tile_width * tile_height > 1)
-        {
-            u16b a_dummy = (use_graphics? COLOUR_WHITE: 0);
-            char c_dummy = (use_graphics? ' ': 0);
-
-            Term_big_queue_char_safe(x_off, y, a, c, a_dummy, c_dummy);
-        }
-    }
+    if (map_grid_drawable(x, y))
+        map_grid_draw(x, y, a, c, tap, tcp);
 
     /* Queue for later */
     else
@@ -4191,6 +4227,145 @@ static int Receive_flush(void)
 }
 
 
+/*
+ * Grids drawn by the projection visuals of a turn, erased once the whole frame has been played
+ * (a frame may span several packets)
+ */
+static struct loc *effect_drawn;
+static int effect_num_drawn, effect_max_drawn;
+
+
+static void effect_erase(void)
+{
+    int i;
+
+    for (i = 0; i < effect_num_drawn; i++)
+        map_grid_restore(effect_drawn[i].x, effect_drawn[i].y);
+}
+
+
+/*
+ * Play the projection visuals of a turn
+ */
+static int Receive_effect(void)
+{
+    static struct
+    {
+        byte op, x, y, a;
+        char c;
+    } ops[EFFECT_MAX_OPS];
+    byte ch;
+    s16b num;
+    int n, i;
+    int bytes_read;
+    bool more = false;
+
+    if ((n = Packet_scanf(&rbuf, "%b%hd", &ch, &num)) <= 0)
+        return n;
+    bytes_read = 3;
+
+    /* Paranoia */
+    if ((num < 0) || (num > EFFECT_MAX_OPS)) return 0;
+
+    /* Read the whole frame before playing it */
+    for (i = 0; i < num; i++)
+    {
+        ops[i].x = ops[i].y = ops[i].a = 0;
+        ops[i].c = 0;
+
+        if ((n = Packet_scanf(&rbuf, "%b", &ops[i].op)) > 0)
+        {
+            bytes_read++;
+            if (ops[i].op == EFFECT_DRAW)
+            {
+                n = Packet_scanf(&rbuf, "%b%b%b%c", &ops[i].x, &ops[i].y, &ops[i].a, &ops[i].c);
+                if (n > 0) bytes_read += 4;
+            }
+            else if (ops[i].op == EFFECT_RESTORE)
+            {
+                n = Packet_scanf(&rbuf, "%b%b", &ops[i].x, &ops[i].y);
+                if (n > 0) bytes_read += 2;
+            }
+        }
+        if (n <= 0)
+        {
+            /* Rollback the socket buffer */
+            Sockbuf_rollback(&rbuf, bytes_read);
+
+            /* Packet isn't complete, graceful failure */
+            return n;
+        }
+    }
+
+    /* Only play the frame on the main screen */
+    if (player->remote_term != NTERM_WIN_OVERHEAD)
+    {
+        effect_num_drawn = 0;
+        return 1;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        switch (ops[i].op)
+        {
+            case EFFECT_DRAW:
+            {
+                u16b ta = 0;
+                char tc = 0;
+
+                if (!map_grid_drawable(ops[i].x, ops[i].y)) break;
+
+                /* Display the pict over what is under it */
+                if (use_graphics)
+                {
+                    ta = player->trn_info[ops[i].y][ops[i].x].a;
+                    tc = player->trn_info[ops[i].y][ops[i].x].c;
+                }
+                map_grid_draw(ops[i].x, ops[i].y, ops[i].a, ops[i].c, ta, tc);
+
+                /* Remember it */
+                if (effect_num_drawn == effect_max_drawn)
+                {
+                    effect_max_drawn += EFFECT_MAX_OPS;
+                    effect_drawn = mem_realloc(effect_drawn, effect_max_drawn * sizeof(struct loc));
+                }
+                loc_init(&effect_drawn[effect_num_drawn++], ops[i].x, ops[i].y);
+                break;
+            }
+            case EFFECT_RESTORE:
+                map_grid_restore(ops[i].x, ops[i].y);
+                break;
+            case EFFECT_CLEAR:
+                effect_erase();
+                break;
+            case EFFECT_FRESH:
+                Term_fresh();
+                break;
+            case EFFECT_DELAY:
+                Term_xtra(TERM_XTRA_DELAY, player->opts.delay_factor);
+                break;
+            case EFFECT_FRESH_DELAY:
+                Term_fresh();
+                Term_xtra(TERM_XTRA_DELAY, player->opts.delay_factor);
+                break;
+            case EFFECT_MORE:
+                more = true;
+                break;
+        }
+    }
+
+    /* The rest of the frame comes in the next packet */
+    if (more) return 1;
+
+    /* Erase anything left on screen */
+    effect_erase();
+    effect_num_drawn = 0;
+    Term_fresh();
+
+    return 1;
+}
+
+
 static int Receive_channel(void)
 {
     int n, j, free = -1;
@@ -6282,6 +6457,10 @@ void Net_cleanup(void)
     Sockbuf_cleanup(&wbuf);
     Sockbuf_cleanup(&qbuf);
 
+    mem_free(effect_drawn);
+    effect_drawn = NULL;
+    effect_num_drawn = effect_max_drawn = 0;
+
     /*
      * Make sure that we won't try to write to the socket again,
      * after our connection has closed
@@ -210,6 +210,15 @@ static void do_cmd_knowledge_dungeons(const char *title, int row)
 }
 
 
+/*
+ * Display items for sale in player owned stores
+ */
+static void do_cmd_knowledge_market(const char *title, int row)
+{
+    do_cmd_knowledge_aux(SPECIAL_FILE_MARKET, "Player Store Items", true);
+}
+
+
 /*
  * Definition of the "player knowledge" menu.
  */
@@ -227,7 +236,8 @@ static menu_action knowledge_actions[] =
     {0, 0, "Display known uniques", do_cmd_knowledge_uniques},
     {0, 0, "Display party gear", do_cmd_knowledge_gear},
     {0, 0, "Display owned houses", do_cmd_knowledge_houses},
-    {0, 0, "Display visited dungeons and towns", do_cmd_knowledge_dungeons}
+    {0, 0, "Display visited dungeons and towns", do_cmd_knowledge_dungeons},
+    {0, 0, "Display items for sale in player stores", do_cmd_knowledge_market}
 };
 
 
@@ -68,6 +68,7 @@ PKT(TERM, undefined, undefined, undefined, term_info)
 PKT(PLAYER, undefined, undefined, undefined, player_pos)
 PKT(MINIPOS, undefined, undefined, undefined, minipos)
 PKT(MESSAGE_FLUSH, undefined, undefined, undefined, message_flush)
+PKT(EFFECT, undefined, undefined, undefined, effect)
 /* Packets sent from the client */
 PKT(VERIFY, verify, undefined, undefined, undefined)
 PKT(ICKY, icky, icky, undefined, undefined)
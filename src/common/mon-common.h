@@ -53,7 +53,8 @@ enum
     RST_SUMMON      = 0x0400,
     RST_INNATE      = 0x0800,
     RST_ARCHERY     = 0x1000,
-    RST_MISSILE     = 0x2000
+    RST_MISSILE     = 0x2000,
+    RST_MAX         = 0x4000    /* Next unused bit, must stay last */
 };
 
 #define RST_DAMAGE (RST_BOLT | RST_BALL | RST_BREATH | RST_DIRECT)
@@ -293,6 +294,7 @@ struct target
     struct loc grid;
     struct source target_who;
     bool target_set;
+    u32b target_gen;    /* Generation of the target monster */
 };
 
 /*
@@ -306,6 +308,7 @@ struct monster
     struct monster_race *race;              /* Monster's (current) race */
     struct monster_race *original_race;     /* Changed monster's original race */
     int midx;
+    u32b generation;                        /* Unique number, changes when the slot is reused */
     struct loc grid;                        /* Location on map */
     s32b hp;                                /* Current Hit points */
     s32b maxhp;                             /* Max Hit points */
@@ -340,6 +343,8 @@ struct monster
     byte origin;                            /* How this monster was created */
     u16b feat;                              /* Terrain under monster (for feature mimics) */
     struct loc old_grid;                    /* Previous monster location */
+    bool dormant;                           /* Monster is far from every player (transient) */
+    u32b dormant_stamp;                     /* Level stamp when going dormant (transient) */
 };
 
 /*
@@ -352,6 +357,7 @@ struct monster_race_message
     int msg_code;               /* The coded message */
     int count;                  /* How many monsters triggered this message */
     int delay;                  /* Messages will be processed in this order: delay = 0, 1, 2 */
+    int next;                   /* Next entry in the same hash bucket (plus one) */
 };
 
 /*
@@ -361,6 +367,7 @@ struct monster_message_history
 {
     struct monster *mon;    /* The monster */
     int message_code;       /* The coded message */
+    int next;               /* Next entry in the same hash bucket (plus one) */
 };
 
 /** Variables **/
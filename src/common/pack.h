@@ -85,3 +85,15 @@ enum
 #define NTERM_WIN_MONSTER   5
 #define NTERM_WIN_MONLIST   6
 #define NTERM_WIN_SPECIAL   7
+
+/*
+ * PKT_EFFECT helpers
+ */
+#define EFFECT_MAX_OPS      1024    /* Maximum number of steps in one packet */
+#define EFFECT_DRAW         0       /* Draw a pict over a grid */
+#define EFFECT_RESTORE      1       /* Restore a grid */
+#define EFFECT_CLEAR        2       /* Restore all grids drawn so far */
+#define EFFECT_FRESH        3       /* Refresh the screen */
+#define EFFECT_DELAY        4       /* Wait */
+#define EFFECT_FRESH_DELAY  5       /* Refresh the screen and wait */
+#define EFFECT_MORE         6       /* The frame goes on in the next packet */
@@ -482,6 +482,7 @@ struct player_upkeep
     bool skip_redraw_equip;         /* Skip redraw_equip object */
     struct object *redraw_inven;    /* Single inventory object to redraw */
     bool skip_redraw_inven;         /* Skip redraw_inven object */
+    struct equip_bonuses *equip_bonuses;    /* Bonuses from the equipment (real and known) */
 };
 
 /*
@@ -547,6 +548,7 @@ struct player_square
     bitflag *info;
     struct object *obj;
     struct trap *trap;
+    int pile;               /* Position (+1) of this grid in the known pile list */
 };
 
 struct heatmap
@@ -562,6 +564,9 @@ struct player_cave
     struct player_square **squares;
     struct heatmap noise;
     struct heatmap scent;
+    struct loc *piles;      /* Grids holding a known object pile */
+    int num_piles;          /* Number of grids holding a known object pile */
+    int max_piles;          /* Allocated size of the known pile list */
     bool allocated;
 };
 
@@ -646,6 +651,8 @@ struct player
     s16b stat_cur[STAT_MAX];                    /* Current "natural" stat values */
     s16b stat_map[STAT_MAX];                    /* Tracks remapped stats from temp stat swap */
     s16b *timed;                                /* Timed effects */
+    s16b *timed_list;                           /* Timed effects which may be active, in order */
+    int num_timed;
     s16b word_recall;                           /* Word of recall counter */
     s16b deep_descent;                          /* Deep Descent counter */
     s32b energy;                                /* Current energy */
@@ -689,6 +696,8 @@ struct player
     int size_mon_msg;
     struct monster_race_message *mon_msg;
     struct monster_message_history *mon_message_hist;
+    int *mon_msg_hash;      /* First stacked message of each hash bucket (plus one) */
+    int *mon_hist_hash;     /* First history entry of each hash bucket (plus one) */
 
     /*** MAngband common fields ***/
 
@@ -700,6 +709,7 @@ struct player
     hturn active_turn;                      /* Number of active player turns */
     bool* kind_aware;                       /* Is the player aware of this obj kind? */
     bool* kind_tried;                       /* Has the player tried this obj kind? */
+    u32b knowledge_epoch;                   /* Object knowledge epoch (see object_desc()) */
     char name[NORMAL_WID];                  /* Nickname */
     char pass[NORMAL_WID];                  /* Password */
     s32b id;                                /* Unique ID to each player */
@@ -812,6 +822,7 @@ struct player
     byte *randart_created;              /* Randarts player has created */
     byte *spell_power;                  /* Spell power array */
     byte *spell_cooldown;               /* Spell cooldown array */
+    int num_cooldowns;                  /* Number of spells on cooldown */
     byte *kind_ignore;                  /* Ignore this object kind */
     byte *kind_everseen;                /* Has the player seen this object kind? */
     byte **ego_ignore_types;            /* Table for ignoring by ego and type */
@@ -846,6 +857,7 @@ struct player
     bool shimmer;                   /* Hack -- optimize multi-hued code (players) */
     bool delayed_display;           /* Hack -- delay messages after character creation */
     bool did_visuals;               /* Hack -- projection indicator (visuals) */
+    struct effect_frame *effect_frame;  /* Queued projection visuals */
     struct loc old_grid;            /* Previous player location */
     bool path_drawn;                /* NPP's visible targeting */
     int path_n;
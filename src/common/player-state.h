@@ -105,6 +105,7 @@ struct player_state
     /*** PWMAngband extracted fields ***/
 
     bool cumber_shield;         /* Encumbering shield */
+    int extra_blows;            /* Extra blows x10 */
 };
 
 #endif /* INCLUDED_PLAYER_STATE_H */
@@ -86,6 +86,7 @@ struct store
     int normal_stock_max;
 
     s16b max_depth;             /* Max level of last customer */
+    int maint_pending;          /* Maintenance passes not applied yet */
 
     char comment_welcome[N_WELCOME][NORMAL_WID];
 };
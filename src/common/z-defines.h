@@ -117,6 +117,7 @@
 #define SPECIAL_FILE_HELP       16
 #define SPECIAL_FILE_RUNE       17
 #define SPECIAL_FILE_DUNGEONS   18
+#define SPECIAL_FILE_MARKET     19
 
 /* Is string empty? Beats calling strlen */
 #define STRZERO(S) \
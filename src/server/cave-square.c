@@ -1474,6 +1474,7 @@ void square_excise_object(struct chunk *c, struct loc *grid, struct object *obj)
 {
     my_assert(square_in_bounds(c, grid));
     pile_excise(&square(c, grid)->obj, obj);
+    house_stock_changed(&c->wpos, grid);
 
     /* Hack -- excise object index */
     c->o_gen[0 - (obj->oidx + 1)] = false;
@@ -1530,6 +1531,7 @@ void square_excise_pile(struct chunk *c, struct loc *grid)
 
     object_pile_free(square_object(c, grid));
     square_set_obj(c, grid, NULL);
+    house_stock_changed(&c->wpos, grid);
 
     /* Redraw */
     redraw_floor(&c->wpos, grid, NULL);
@@ -1642,6 +1644,51 @@ static bool object_equals(const struct object *obj1, const struct object *obj2)
 }
 
 
+/*
+ * Add a grid to the list of grids holding a known object pile
+ */
+void square_note_pile(struct player *p, struct loc *grid)
+{
+    struct player_cave *cv = p->cave;
+
+    /* Already listed */
+    if (square_p(p, grid)->pile) return;
+
+    /* Extend the pile list */
+    if (cv->num_piles == cv->max_piles)
+    {
+        cv->max_piles += 64;
+        cv->piles = mem_realloc(cv->piles, cv->max_piles * sizeof(struct loc));
+    }
+
+    loc_copy(&cv->piles[cv->num_piles], grid);
+    cv->num_piles++;
+    square_p(p, grid)->pile = cv->num_piles;
+}
+
+
+/*
+ * Remove a grid from the list of grids holding a known object pile
+ */
+static void square_unnote_pile(struct player *p, struct loc *grid)
+{
+    struct player_cave *cv = p->cave;
+    int pile = square_p(p, grid)->pile - 1;
+
+    /* Not listed */
+    if ((pile < 0) || (pile >= cv->num_piles)) return;
+
+    /* Move the last grid into the hole */
+    cv->num_piles--;
+    if (pile < cv->num_piles)
+    {
+        loc_copy(&cv->piles[pile], &cv->piles[cv->num_piles]);
+        square_p(p, &cv->piles[pile])->pile = pile + 1;
+    }
+    square_p(p, grid)->pile = 0;
+}
+
+
 static void square_update_pile(struct player *p, struct chunk *c, struct loc *grid)
 {
     struct object *obj;
@@ -1657,6 +1704,8 @@ static void square_update_pile(struct player *p, struct chunk *c, struct loc *gr
         /* Attach it to the current floor pile */
         pile_insert_end(&square_p(p, grid)->obj, new_obj);
     }
+
+    if (square_p(p, grid)->obj) square_note_pile(p, grid);
 }
 
 
@@ -1717,6 +1766,7 @@ void square_forget_pile(struct player *p, struct loc *grid)
         current = next;
     }
     square_p(p, grid)->obj = NULL;
+    square_unnote_pile(p, grid);
 }
 
 
@@ -1777,6 +1827,10 @@ void square_set_feat(struct chunk *c, struct loc *grid, int feat)
     /* Make the change */
     square(c, grid)->feat = feat;
 
+    /* Forget projection paths and teleport destinations */
+    los_memo_reset(c);
+    c->tele_grids_ok = false;
+
     /* Light bright terrain */
     if (feat_is_bright(feat)) sqinfo_on(square(c, grid)->info, SQUARE_GLOW);
 
@@ -1815,6 +1869,10 @@ static void square_set_known_feat(struct player *p, struct loc *grid, int feat)
  */
 void square_set_mon(struct chunk *c, struct loc *grid, int midx)
 {
+    /* Update the actor index */
+    if (!square(c, grid)->mon && midx) actor_cells_update(c, grid, 1);
+    else if (square(c, grid)->mon && !midx) actor_cells_update(c, grid, -1);
+
     square(c, grid)->mon = midx;
 }
 
@@ -424,12 +424,15 @@ struct chunk *cave_new(int height, int width)
 
     c->monsters = mem_zalloc(z_info->level_monster_max * sizeof(struct monster));
     c->mon_max = 1;
+    c->mon_free = mem_zalloc(z_info->level_monster_max * sizeof(u16b));
 
     c->monster_groups = mem_zalloc(z_info->level_monster_max * sizeof(struct monster_group*));
 
     c->o_gen = mem_zalloc(MAX_OBJECTS * sizeof(bool));
     c->join = mem_zalloc(sizeof(struct connector));
 
+    actor_cells_reset(c);
+
     return c;
 }
 
@@ -457,9 +460,17 @@ void cave_free(struct chunk *c)
 
     mem_free(c->feat_count);
     mem_free(c->monsters);
+    mem_free(c->mon_free);
     mem_free(c->monster_groups);
+    monster_census_free(c->census);
     mem_free(c->o_gen);
     mem_free(c->join);
+    los_memo_free(c);
+    mem_free(c->mon_ready);
+    mem_free(c->actor_cells);
+    mem_free(c->tele_grids);
+    mem_free(c->anchors);
+    mem_free(c->house_grids);
     mem_free(c);
 }
 
@@ -506,6 +517,166 @@ bool scatter(struct chunk *c, struct loc *place, struct loc *grid, int d, bool n
 }
 
 
+/*
+ * Get the grids where something could be teleported to, in row order.
+ *
+ * This only checks the terrain (fully in bounds, not part of a vault, monster
+ * walkable), the caller must still check the occupants. The list is rebuilt
+ * after a terrain change.
+ */
+struct loc *cave_tele_grids(struct chunk *c, int *num)
+{
+    if (!c->tele_grids_ok)
+    {
+        struct loc begin, end;
+        struct loc_iterator iter;
+
+        if (!c->tele_grids) c->tele_grids = mem_alloc(c->height * c->width * sizeof(struct loc));
+        c->num_tele_grids = 0;
+
+        loc_init(&begin, 1, 1);
+        loc_init(&end, c->width - 1, c->height - 1);
+        loc_iterator_first(&iter, &begin, &end);
+
+        do
+        {
+            if (square_isvault(c, &iter.cur) || !square_is_monster_walkable(c, &iter.cur))
+                continue;
+            loc_copy(&c->tele_grids[c->num_tele_grids++], &iter.cur);
+        }
+        while (loc_iterator_next_strict(&iter));
+
+        c->tele_grids_ok = true;
+    }
+
+    *num = c->num_tele_grids;
+    return c->tele_grids;
+}
+
+
+/*
+ * Actor index
+ *
+ * The level is split into blocks of 8x8 grids, each one counting the monsters
+ * and players standing on it (this is kept up to date by square_set_mon()).
+ * Searches for the actors inside an area can then skip the empty blocks, so
+ * their cost no longer depends on the number of monsters on the level.
+ */
+
+
+#define ACTOR_CELL_SHIFT    3
+
+
+/*
+ * Get the counter of the block of grids holding the given grid
+ */
+static u16b *actor_cell(struct chunk *c, struct loc *grid)
+{
+    return &c->actor_cells[(grid->y >> ACTOR_CELL_SHIFT) * c->actor_cell_wid +
+        (grid->x >> ACTOR_CELL_SHIFT)];
+}
+
+
+/*
+ * Rebuild the actor index (when the level is created or resized)
+ */
+void actor_cells_reset(struct chunk *c)
+{
+    struct loc grid;
+    int rows = (c->height + (1 << ACTOR_CELL_SHIFT) - 1) >> ACTOR_CELL_SHIFT;
+
+    c->actor_cell_wid = (c->width + (1 << ACTOR_CELL_SHIFT) - 1) >> ACTOR_CELL_SHIFT;
+    mem_free(c->actor_cells);
+    c->actor_cells = mem_zalloc(c->actor_cell_wid * rows * sizeof(u16b));
+
+    for (grid.y = 0; grid.y < c->height; grid.y++)
+    {
+        for (grid.x = 0; grid.x < c->width; grid.x++)
+        {
+            if (square(c, &grid)->mon) (*actor_cell(c, &grid))++;
+        }
+    }
+}
+
+
+/*
+ * Add n actors to the block of grids holding the given grid
+ */
+void actor_cells_update(struct chunk *c, struct loc *grid, int n)
+{
+    *actor_cell(c, grid) += n;
+}
+
+
+/*
+ * Scan the actor index from the current position of the iterator
+ */
+static bool actor_iterator_scan(struct actor_iterator *iter, struct chunk *c)
+{
+    while (true)
+    {
+        struct loc top_left, bottom_right;
+
+        /* Part of the current block inside the rectangle */
+        loc_init(&top_left, MAX(iter->cell.x << ACTOR_CELL_SHIFT, iter->begin.x),
+            MAX(iter->cell.y << ACTOR_CELL_SHIFT, iter->begin.y));
+        loc_init(&bottom_right, MIN(((iter->cell.x + 1) << ACTOR_CELL_SHIFT) - 1, iter->end.x),
+            MIN(((iter->cell.y + 1) << ACTOR_CELL_SHIFT) - 1, iter->end.y));
+
+        /* Only scan blocks holding something */
+        if (*actor_cell(c, &top_left))
+        {
+            for (; iter->cur.y <= bottom_right.y; iter->cur.y++, iter->cur.x = top_left.x)
+            {
+                for (; iter->cur.x <= bottom_right.x; iter->cur.x++)
+                {
+                    if (square(c, &iter->cur)->mon) return true;
+                }
+            }
+        }
+
+        /* Next block */
+        iter->cell.x++;
+        if ((iter->cell.x << ACTOR_CELL_SHIFT) > iter->end.x)
+        {
+            iter->cell.x = iter->begin.x >> ACTOR_CELL_SHIFT;
+            iter->cell.y++;
+            if ((iter->cell.y << ACTOR_CELL_SHIFT) > iter->end.y) return false;
+        }
+        loc_init(&iter->cur, MAX(iter->cell.x << ACTOR_CELL_SHIFT, iter->begin.x),
+            MAX(iter->cell.y << ACTOR_CELL_SHIFT, iter->begin.y));
+    }
+}
+
+
+/*
+ * Find the first grid holding a monster or a player inside a rectangle
+ * (bounds are inclusive and get clipped to the level)
+ */
+bool actor_iterator_first(struct actor_iterator *iter, struct chunk *c, struct loc *begin,
+    struct loc *end)
+{
+    loc_init(&iter->begin, MAX(begin->x, 0), MAX(begin->y, 0));
+    loc_init(&iter->end, MIN(end->x, c->width - 1), MIN(end->y, c->height - 1));
+    if ((iter->begin.x > iter->end.x) || (iter->begin.y > iter->end.y)) return false;
+
+    loc_init(&iter->cell, iter->begin.x >> ACTOR_CELL_SHIFT, iter->begin.y >> ACTOR_CELL_SHIFT);
+    loc_copy(&iter->cur, &iter->begin);
+
+    return actor_iterator_scan(iter, c);
+}
+
+
+/*
+ * Find the next grid holding a monster or a player
+ */
+bool actor_iterator_next(struct actor_iterator *iter, struct chunk *c)
+{
+    iter->cur.x++;
+    return actor_iterator_scan(iter, c);
+}
+
+
 /*
  * Get a monster on the current level by its index.
  */
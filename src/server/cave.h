@@ -112,9 +112,12 @@ struct chunk
     struct monster *monsters;
     u16b mon_max;
     u16b mon_cnt;
+    u16b *mon_free;             /* Dead monster slots below mon_max, ready for reuse */
+    int num_free;
     int num_repro;
 
     struct monster_group **monster_groups;
+    struct monster_census *census;
 
     struct connector *join;
 
@@ -127,6 +130,44 @@ struct chunk
     bool gen_hack;
 
     int profile;
+
+    struct los_memo *los_memo;
+
+    u16b *mon_ready;            /* Monsters left to process after the players */
+    int num_ready;
+    bool ready_ok;              /* List of monsters left to process is valid */
+
+    u32b dormant_stamp;         /* Bumped when a player appears somewhere on the level */
+
+    hturn repro_turn;           /* Start of the current breeding window */
+    int repro_window;           /* Clones born during the current breeding window */
+    u32b repro_births;          /* Clones born on the level */
+    u32b repro_throttled;       /* Breeding attempts refused by the throttle */
+
+    u16b *actor_cells;          /* Number of monsters and players in each block of grids */
+    int actor_cell_wid;
+
+    struct loc *tele_grids;     /* Grids where something could be teleported to */
+    int num_tele_grids;
+    bool tele_grids_ok;         /* List of teleport destinations is valid */
+
+    s32b *anchors;              /* Players who raised a space-time anchor on the level */
+    int num_anchors;
+    int max_anchors;
+
+    int *house_grids;           /* House covering each grid (plus one), built when needed */
+    u32b house_stamp;           /* Value of the house stamp when the grids were indexed */
+};
+
+/*
+ * Iterator over the grids holding a monster or a player inside a rectangle
+ */
+struct actor_iterator
+{
+    struct loc begin;   /* Top left corner of the rectangle */
+    struct loc end;     /* Bottom right corner of the rectangle (inclusive) */
+    struct loc cell;    /* Current block of grids */
+    struct loc cur;     /* Current grid */
 };
 
 /*
@@ -249,6 +290,12 @@ extern void set_terrain(void);
 extern struct chunk *cave_new(int height, int width);
 extern void cave_free(struct chunk *c);
 extern bool scatter(struct chunk *c, struct loc *place, struct loc *grid, int d, bool need_los);
+extern struct loc *cave_tele_grids(struct chunk *c, int *num);
+extern void actor_cells_reset(struct chunk *c);
+extern void actor_cells_update(struct chunk *c, struct loc *grid, int n);
+extern bool actor_iterator_first(struct actor_iterator *iter, struct chunk *c, struct loc *begin,
+    struct loc *end);
+extern bool actor_iterator_next(struct actor_iterator *iter, struct chunk *c);
 extern struct monster *cave_monster(struct chunk *c, int idx);
 extern int cave_monster_max(struct chunk *c);
 extern int cave_monster_count(struct chunk *c);
@@ -435,6 +482,7 @@ extern void square_excise_object(struct chunk *c, struct loc *grid, struct objec
 extern void square_excise_pile(struct chunk *c, struct loc *grid);
 extern void square_delete_object(struct chunk *c, struct loc *grid, struct object *obj,
     bool do_note, bool do_light);
+extern void square_note_pile(struct player *p, struct loc *grid);
 extern void square_sense_pile(struct player *p, struct chunk *c, struct loc *grid);
 extern void square_know_pile(struct player *p, struct chunk *c, struct loc *grid);
 extern void square_forget_pile(struct player *p, struct loc *grid);
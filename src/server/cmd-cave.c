@@ -3565,6 +3565,7 @@ bool build_house(struct player *p)
     loc_init(&h_ptr->grid_2, x2 - 1, y2 - 1);
     h_ptr->price = price;
     h_ptr->state = HOUSE_EXTENDED;
+    house_resized(house);
 
     /* Update the visuals */
     update_visuals(&p->wpos);
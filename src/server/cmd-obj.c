@@ -136,6 +136,7 @@ void do_cmd_uninscribe(struct player *p, int item)
 
     obj->note = 0;
     msg(p, "Inscription removed.");
+    if (!object_is_carried(p, obj)) house_stock_changed(&obj->wpos, &obj->grid);
 
     /* PWMAngband: remove autoinscription if aware */
     if (p->kind_aware[obj->kind->kidx])
@@ -233,6 +234,7 @@ void do_cmd_inscribe(struct player *p, int item, const char *inscription)
 
     /* Save the inscription */
     obj->note = quark_add(inscription);
+    if (!object_is_carried(p, obj)) house_stock_changed(&obj->wpos, &obj->grid);
 
     /* PWMAngband: add autoinscription if aware and inscription has the right format (@xn) */
     if (p->kind_aware[obj->kind->kidx] && (strlen(inscription) == 3) && (inscription[0] == '@') &&
@@ -1006,6 +1008,8 @@ static bool spell_cast(struct player *p, int spell_index, int dir, quark_t note,
         cast_spell_end(p);
 
         /* Put on cooldown */
+        if (!p->spell_cooldown[spell->sidx] && spell->cooldown) p->num_cooldowns++;
+        else if (p->spell_cooldown[spell->sidx] && !spell->cooldown) p->num_cooldowns--;
         p->spell_cooldown[spell->sidx] = spell->cooldown;
     }
 
@@ -45,6 +45,7 @@ static void console_whois(int ind, char *name);
 static void console_message(int ind, char *buf);
 static void console_kick_player(int ind, char *name);
 static void console_rng_test(int ind, char *dummy);
+static void console_breeders(int ind, char *dummy);
 static void console_reload(int ind, char *mod);
 static void console_shutdown(int ind, char *dummy);
 static void console_wrath(int ind, char *name);
@@ -63,6 +64,7 @@ static console_command_ops console_commands[] =
     {"reload", console_reload, 1, "config|news\nReload mangband.cfg or news.txt"},
     {"whois", console_whois, 1, "PLAYERNAME\nDetailed player information"},
     {"rngtest", console_rng_test, 0, "\nPerform RNG test"},
+    {"breeders", console_breeders, 0, "\nList levels with breeding monsters"},
     {"debug", console_debug, 0, "\nUnused"}
 };
 
@@ -484,6 +486,47 @@ static void console_kick_player(int ind, char *name)
 }
 
 
+/*
+ * Return the breeding statistics of allocated levels
+ */
+static void console_breeders(int ind, char *dummy)
+{
+    int i, num = 0;
+    struct loc grid;
+    sockbuf_t *console_buf_w = (sockbuf_t*)console_buffer(ind, CONSOLE_WRITE);
+
+    /* Scan the allocated levels */
+    for (grid.y = radius_wild; grid.y >= 0 - radius_wild; grid.y--)
+    {
+        for (grid.x = 0 - radius_wild; grid.x <= radius_wild; grid.x++)
+        {
+            struct wild_type *w_ptr = get_wt_info_at(&grid);
+
+            for (i = 0; i <= w_ptr->max_depth - w_ptr->min_depth; i++)
+            {
+                struct chunk *c = w_ptr->chunk_list[i];
+                char *entry;
+
+                /* Only levels with breeding going on */
+                if (!c || (!c->num_repro && !c->repro_births)) continue;
+
+                /* Add an entry */
+                entry = format("%d ft (%d, %d): %d/%d clones, %lu born, %lu throttled\n",
+                    c->wpos.depth * 50, c->wpos.grid.x, c->wpos.grid.y, c->num_repro,
+                    z_info->repro_monster_max, (unsigned long)c->repro_births,
+                    (unsigned long)c->repro_throttled);
+                Packet_printf(console_buf_w, "%S", entry);
+                num++;
+            }
+        }
+    }
+
+    /* Footer */
+    Packet_printf(console_buf_w, "%s", format("%d levels with breeders\n", num));
+    Sockbuf_flush(console_buf_w);
+}
+
+
 /*  
  * Test the integrity of the RNG
  */
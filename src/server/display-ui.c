@@ -5080,13 +5080,147 @@ void bolt_pict(struct player *p, struct loc *start, struct loc *end, int typ, by
 }
 
 
+/*
+ * Projection visuals
+ *
+ * Bolts and explosions are not sent grid by grid with a flush after each step: the steps are
+ * queued for each player and sent as a single packet when the output of the turn is sent to
+ * the client, which then plays them locally.
+ */
+
+
+static void effect_frame_send_aux(struct player *p, bool more);
+
+
+/*
+ * Queue a step of the projection visuals for a player
+ */
+static void effect_frame_push(struct player *p, struct chunk *cv, byte op, struct loc *grid,
+    byte a, char c)
+{
+    struct effect_frame *frame = p->effect_frame;
+    struct effect_op *step;
+
+    if (!frame) frame = p->effect_frame = mem_zalloc(sizeof(struct effect_frame));
+
+    /* Discard visuals from another level */
+    if (frame->num_ops && !wpos_eq(&frame->wpos, &cv->wpos)) frame->num_ops = 0;
+    memcpy(&frame->wpos, &cv->wpos, sizeof(struct worldpos));
+
+    /*
+     * Send a full packet right away, telling the client that the frame goes on (one step is
+     * left for the mark)
+     */
+    if (frame->num_ops == EFFECT_MAX_OPS - 1) effect_frame_send_aux(p, true);
+
+    /* Nothing to refresh or restore if nothing has been drawn yet */
+    if ((op != EFFECT_DRAW) && !frame->num_ops && !frame->more) return;
+
+    /* Merge consecutive refreshes */
+    if ((op == EFFECT_FRESH) && frame->num_ops)
+    {
+        step = &frame->ops[frame->num_ops - 1];
+        if ((step->op == EFFECT_FRESH) || (step->op == EFFECT_FRESH_DELAY)) return;
+    }
+
+    /* Make room */
+    if (frame->num_ops == frame->max_ops)
+    {
+        frame->max_ops += 64;
+        frame->ops = mem_realloc(frame->ops, frame->max_ops * sizeof(struct effect_op));
+    }
+
+    step = &frame->ops[frame->num_ops++];
+    step->op = op;
+    if (grid) loc_copy(&step->grid, grid);
+    else loc_init(&step->grid, 0, 0);
+    step->a = a;
+    step->c = c;
+}
+
+
+static void effect_frame_flush(struct player *p, struct chunk *cv, bool fresh, bool delay)
+{
+    byte op = (fresh? (delay? EFFECT_FRESH_DELAY: EFFECT_FRESH): EFFECT_DELAY);
+
+    effect_frame_push(p, cv, op, NULL, 0, 0);
+}
+
+
+/*
+ * Send the projection visuals queued for a player
+ *
+ * If "more" is set, the client keeps what has been drawn so far on screen until the rest of
+ * the frame has been received.
+ */
+static void effect_frame_send_aux(struct player *p, bool more)
+{
+    struct effect_frame *frame = p->effect_frame;
+    int i, n = 0;
+
+    /* Nothing to send, unless the client waits for the end of the frame */
+    if (!frame || (!frame->num_ops && !frame->more)) return;
+
+    /* Only play the visuals of the current level */
+    if (wpos_eq(&frame->wpos, &p->wpos))
+    {
+        /* Convert grids to screen coordinates, skipping grids which are no longer displayed */
+        for (i = 0; i < frame->num_ops; i++)
+        {
+            struct effect_op *step = &frame->ops[i];
+
+            if ((step->op == EFFECT_DRAW) || (step->op == EFFECT_RESTORE))
+            {
+                if (!panel_contains(p, &step->grid)) continue;
+                loc_init(&step->grid, step->grid.x - p->offset_grid.x,
+                    step->grid.y - p->offset_grid.y + 1);
+            }
+
+            if (n != i) memcpy(&frame->ops[n], step, sizeof(struct effect_op));
+            n++;
+        }
+    }
+
+    /* Mark the frame as going on */
+    if (more)
+    {
+        frame->ops[n].op = EFFECT_MORE;
+        loc_init(&frame->ops[n].grid, 0, 0);
+        frame->ops[n].a = 0;
+        frame->ops[n].c = 0;
+        n++;
+    }
+
+    /* An empty packet still ends a frame left open by the last one */
+    if (n || frame->more) Send_effect(p, frame->ops, n);
+
+    frame->num_ops = 0;
+    frame->more = more;
+}
+
+
+void effect_frame_send(struct player *p)
+{
+    effect_frame_send_aux(p, false);
+}
+
+
+void effect_frame_free(struct player *p)
+{
+    if (!p->effect_frame) return;
+    mem_free(p->effect_frame->ops);
+    mem_free(p->effect_frame);
+    p->effect_frame = NULL;
+}
+
+
 /*
  * Draw an explosion
  */
-void display_explosion(struct chunk *cv, struct explosion *data, const bool *drawing, bool arc)
+void display_explosion(struct chunk *cv, struct explosion *data, const bitflag *drawing, bool arc)
 {
     bool new_radius = false;
-    bool drawn[MAX_PLAYERS];
+    bitflag drawn[DRAWING_SIZE];
     int i, j;
     int proj_type = data->proj_type;
     int num_grids = data->num_grids;
@@ -5094,7 +5228,7 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
     struct loc *blast_grid = (struct loc *)data->blast_grid;
 
     /* Assume the player has seen no blast grids */
-    for (i = 0; i < MAX_PLAYERS; ++i) drawn[i] = false;
+    flag_wipe(drawn, DRAWING_SIZE);
 
     /* Draw the blast from inside out */
     for (i = 0; i < num_grids; i++)
@@ -5119,13 +5253,13 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
                 byte a;
                 char c;
 
-                drawn[j] = true;
+                flag_on(drawn, DRAWING_SIZE, j);
 
                 /* Obtain the explosion pict */
                 bolt_pict(p, &blast_grid[i], &blast_grid[i], proj_type, &a, &c);
 
                 /* Just display the pict, ignoring what was under it */
-                draw_path_grid(p, &blast_grid[i], a, c);
+                effect_frame_push(p, cv, EFFECT_DRAW, &blast_grid[i], a, c);
             }
         }
 
@@ -5148,10 +5282,10 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
                 if (p->timed[TMD_BLIND]) continue;
 
                 /* Delay to show this radius appearing */
-                if (drawing[j] || drawn[j])
-                    Send_flush(p, true, true);
+                if (flag_has(drawing, DRAWING_SIZE, j) || flag_has(drawn, DRAWING_SIZE, j))
+                    effect_frame_flush(p, cv, true, true);
                 else
-                    Send_flush(p, true, false);
+                    effect_frame_flush(p, cv, true, false);
             }
 
             new_radius = false;
@@ -5168,24 +5302,13 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
         if (p->timed[TMD_BLIND]) continue;
 
         /* Erase and flush */
-        if (drawn[j])
+        if (flag_has(drawn, DRAWING_SIZE, j))
         {
             /* Erase the explosion drawn above */
-            for (i = 0; i < num_grids; i++)
-            {
-                /* Hack -- don't draw over breather */
-                if (arc && !distance_to_grid[i]) continue;
-
-                /* Skip irrelevant players */
-                if (!panel_contains(p, &blast_grid[i])) continue;
-
-                /* Erase visible, valid grids */
-                if (square_isview(p, &blast_grid[i]))
-                    square_light_spot_aux(p, cv, &blast_grid[i]);
-            }
+            effect_frame_push(p, cv, EFFECT_CLEAR, NULL, 0, 0);
 
             /* Flush the explosion */
-            Send_flush(p, true, false);
+            effect_frame_flush(p, cv, true, false);
         }
     }
 
@@ -5199,7 +5322,7 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
         if (p->timed[TMD_BLIND]) continue;
 
         /* Add one to the count */
-        if (drawn[j]) p->did_visuals = true;
+        if (flag_has(drawn, DRAWING_SIZE, j)) p->did_visuals = true;
     }
 }
 
@@ -5207,7 +5330,7 @@ void display_explosion(struct chunk *cv, struct explosion *data, const bool *dra
 /*
  * Draw a moving spell effect (bolt or beam)
  */
-void display_bolt(struct chunk *cv, struct bolt *data, bool *drawing)
+void display_bolt(struct chunk *cv, struct bolt *data, bitflag *drawing)
 {
     int j;
 
@@ -5231,8 +5354,11 @@ void display_bolt(struct chunk *cv, struct bolt *data, bool *drawing)
             /* Obtain the bolt pict */
             bolt_pict(p, &data->ogrid, &data->grid, data->proj_type, &a, &c);
 
-            /* Visual effects */
-            flush_path_grid(p, cv, &data->grid, a, c);
+            /* Draw, Highlight, Fresh, Pause, Erase */
+            effect_frame_push(p, cv, EFFECT_DRAW, &data->grid, a, c);
+            effect_frame_flush(p, cv, true, true);
+            effect_frame_push(p, cv, EFFECT_RESTORE, &data->grid, 0, 0);
+            effect_frame_flush(p, cv, true, false);
 
             /* Display "beam" grids */
             if (data->beam)
@@ -5241,16 +5367,16 @@ void display_bolt(struct chunk *cv, struct bolt *data, bool *drawing)
                 bolt_pict(p, &data->grid, &data->grid, data->proj_type, &a, &c);
 
                 /* Visual effects */
-                draw_path_grid(p, &data->grid, a, c);
+                effect_frame_push(p, cv, EFFECT_DRAW, &data->grid, a, c);
             }
 
             /* Activate delay */
-            drawing[j] = true;
+            flag_on(drawing, DRAWING_SIZE, j);
         }
 
         /* Delay for consistency */
-        else if (drawing[j])
-            Send_flush(p, false, true);
+        else if (flag_has(drawing, DRAWING_SIZE, j))
+            effect_frame_flush(p, cv, false, true);
     }
 }
 
@@ -6,6 +6,11 @@
 #ifndef INCLUDED_DISPLAY_UI_H
 #define INCLUDED_DISPLAY_UI_H
 
+/*
+ * Set of players drawing a projection, indexed by player index
+ */
+#define DRAWING_SIZE FLAG_SIZE(MAX_PLAYERS)
+
 struct explosion
 {
     int proj_type;
@@ -29,6 +34,29 @@ struct missile
     struct loc grid;
 };
 
+/*
+ * A step of the projection visuals queued for a player
+ */
+struct effect_op
+{
+    byte op;
+    struct loc grid;
+    byte a;
+    char c;
+};
+
+/*
+ * Projection visuals queued for a player during the current turn
+ */
+struct effect_frame
+{
+    struct worldpos wpos;
+    struct effect_op *ops;
+    int num_ops;
+    int max_ops;
+    bool more;                  /* The client keeps the grids drawn by the last packet */
+};
+
 struct message
 {
     const char *msg;
@@ -58,9 +86,11 @@ extern void describe_feat(struct player *p, struct feature *feat);
 extern void player_dump(struct player *p, bool server);
 extern void bolt_pict(struct player *p, struct loc *start, struct loc *end, int typ, byte *a,
     char *c);
-extern void display_explosion(struct chunk *cv, struct explosion *data, const bool *drawing,
+extern void effect_frame_send(struct player *p);
+extern void effect_frame_free(struct player *p);
+extern void display_explosion(struct chunk *cv, struct explosion *data, const bitflag *drawing,
     bool arc);
-extern void display_bolt(struct chunk *cv, struct bolt *data, bool *drawing);
+extern void display_bolt(struct chunk *cv, struct bolt *data, bitflag *drawing);
 extern void display_missile(struct chunk *cv, struct missile *data);
 extern void display_message(struct player *p, struct message *data);
 
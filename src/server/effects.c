@@ -733,49 +733,53 @@ static bool detect_monsters(struct player *p, int y_dist, int x_dist, monster_pr
     struct source who_body;
     struct source *who = &who_body;
     struct chunk *c = chunk_get(&p->wpos);
+    struct loc begin, end;
+    struct actor_iterator iter;
 
     /* Set the detection area */
     y1 = p->grid.y - y_dist;
     y2 = p->grid.y + y_dist;
     x1 = p->grid.x - x_dist;
     x2 = p->grid.x + x_dist;
+    loc_init(&begin, x1, y1);
+    loc_init(&end, x2, y2);
 
-    /* Scan monsters */
-    for (i = 1; i < cave_monster_max(c); i++)
+    /* Scan monsters in the detection area */
+    if (actor_iterator_first(&iter, c, &begin, &end))
     {
-        struct monster *mon = cave_monster(c, i);
-        struct monster_lore *lore;
-
-        /* Skip dead monsters */
-        if (!mon->race) continue;
+        do
+        {
+            struct monster *mon = square_monster(c, &iter.cur);
+            struct monster_lore *lore;
 
-        lore = get_lore(p, mon->race);
+            /* Skip players */
+            if (!mon) continue;
 
-        /* Only detect nearby monsters */
-        if ((mon->grid.x < x1) || (mon->grid.y < y1) || (mon->grid.x > x2) || (mon->grid.y > y2))
-            continue;
+            lore = get_lore(p, mon->race);
 
-        /* Detect all appropriate, obvious monsters */
-        if (pred(mon))
-        {
-            struct actor_race *monster_race = &p->upkeep->monster_race;
+            /* Detect all appropriate, obvious monsters */
+            if (pred(mon))
+            {
+                struct actor_race *monster_race = &p->upkeep->monster_race;
 
-            /* Increment detection counter */
-            source_monster(who, mon);
-            give_detect(p, who);
+                /* Increment detection counter */
+                source_monster(who, mon);
+                give_detect(p, who);
 
-            /* Skip visible monsters */
-            if (monster_is_visible(p, i)) continue;
+                /* Skip visible monsters */
+                if (monster_is_visible(p, mon->midx)) continue;
 
-            /* Take note that they are detectable */
-            if (flag) rf_on(lore->flags, flag);
+                /* Take note that they are detectable */
+                if (flag) rf_on(lore->flags, flag);
 
-            /* Update monster recall window */
-            if (ACTOR_RACE_EQUAL(monster_race, mon)) p->upkeep->redraw |= (PR_MONSTER);
+                /* Update monster recall window */
+                if (ACTOR_RACE_EQUAL(monster_race, mon)) p->upkeep->redraw |= (PR_MONSTER);
 
-            /* Detect */
-            monsters = true;
+                /* Detect */
+                monsters = true;
+            }
         }
+        while (actor_iterator_next(&iter, c));
     }
 
     /* Scan players */
@@ -3140,32 +3144,38 @@ static bool effect_handler_DETECT_ALL_MONSTERS(effect_handler_context_t *context
 }
 
 
+/*
+ * Pick the area to map around the player, restricted to the grids fully in bounds.
+ *
+ * Detected grids only change the memory of the caster, so they are redrawn for him alone.
+ */
+static void detect_area(effect_handler_context_t *context, struct loc *begin, struct loc *end)
+{
+    struct player *p = context->origin->player;
+
+    loc_init(begin, MAX(p->grid.x - context->x, 1), MAX(p->grid.y - context->y, 1));
+    loc_init(end, MIN(p->grid.x + context->x, context->cave->width - 2),
+        MIN(p->grid.y + context->y, context->cave->height - 2));
+}
+
+
 /*
  * Detect doors around the player. The height to detect above and below the player
  * is context->y, the width either side of the player context->x.
  */
 static bool effect_handler_DETECT_DOORS(effect_handler_context_t *context)
 {
-    int x1, x2, y1, y2;
     bool doors = false, redraw = false;
     struct loc begin, end;
     struct loc_iterator iter;
 
     /* Pick an area to map */
-    y1 = context->origin->player->grid.y - context->y;
-    y2 = context->origin->player->grid.y + context->y;
-    x1 = context->origin->player->grid.x - context->x;
-    x2 = context->origin->player->grid.x + context->x;
-
-    loc_init(&begin, x1, y1);
-    loc_init(&end, x2, y2);
+    detect_area(context, &begin, &end);
     loc_iterator_first(&iter, &begin, &end);
 
     /* Scan the dungeon */
     do
     {
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
-
         /* Detect secret doors */
         if (square_issecretdoor(context->cave, &iter.cur))
         {
@@ -3187,7 +3197,7 @@ static bool effect_handler_DETECT_DOORS(effect_handler_context_t *context)
             square_isnotknown(context->origin->player, context->cave, &iter.cur))
         {
             square_forget(context->origin->player, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             redraw = true;
         }
@@ -3297,32 +3307,23 @@ static bool effect_handler_DETECT_FEARFUL_MONSTERS(effect_handler_context_t *con
  */
 static bool effect_handler_DETECT_GOLD(effect_handler_context_t *context)
 {
-    int x1, x2, y1, y2;
     bool redraw = false;
     struct loc begin, end;
     struct loc_iterator iter;
 
     /* Pick an area to map */
-    y1 = context->origin->player->grid.y - context->y;
-    y2 = context->origin->player->grid.y + context->y;
-    x1 = context->origin->player->grid.x - context->x;
-    x2 = context->origin->player->grid.x + context->x;
-
-    loc_init(&begin, x1, y1);
-    loc_init(&end, x2, y2);
+    detect_area(context, &begin, &end);
     loc_iterator_first(&iter, &begin, &end);
 
     /* Scan the dungeon */
     do
     {
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
-
         /* Magma/Quartz + Known Gold */
         if (square_hasgoldvein(context->cave, &iter.cur))
         {
             /* Memorize */
             square_memorize(context->origin->player, context->cave, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             redraw = true;
         }
@@ -3332,7 +3333,7 @@ static bool effect_handler_DETECT_GOLD(effect_handler_context_t *context)
             square_isnotknown(context->origin->player, context->cave, &iter.cur))
         {
             square_forget(context->origin->player, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             redraw = true;
         }
@@ -3525,32 +3526,23 @@ static bool effect_handler_DETECT_SOUL(effect_handler_context_t *context)
  */
 static bool effect_handler_DETECT_STAIRS(effect_handler_context_t *context)
 {
-    int x1, x2, y1, y2;
     bool stairs = false, redraw = false;
     struct loc begin, end;
     struct loc_iterator iter;
 
     /* Pick an area to map */
-    y1 = context->origin->player->grid.y - context->y;
-    y2 = context->origin->player->grid.y + context->y;
-    x1 = context->origin->player->grid.x - context->x;
-    x2 = context->origin->player->grid.x + context->x;
-
-    loc_init(&begin, x1, y1);
-    loc_init(&end, x2, y2);
+    detect_area(context, &begin, &end);
     loc_iterator_first(&iter, &begin, &end);
 
     /* Scan the dungeon */
     do
     {
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
-
         /* Detect stairs */
         if (square_isstairs(context->cave, &iter.cur))
         {
             /* Memorize */
             square_memorize(context->origin->player, context->cave, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             /* Obvious */
             stairs = true;
@@ -3563,7 +3555,7 @@ static bool effect_handler_DETECT_STAIRS(effect_handler_context_t *context)
             square_isnotknown(context->origin->player, context->cave, &iter.cur))
         {
             square_forget(context->origin->player, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             redraw = true;
         }
@@ -3593,27 +3585,18 @@ static bool effect_handler_DETECT_STAIRS(effect_handler_context_t *context)
  */
 static bool effect_handler_DETECT_TRAPS(effect_handler_context_t *context)
 {
-    int x1, x2, y1, y2;
     bool detect = false, redraw = false;
     struct object *obj;
     struct loc begin, end;
     struct loc_iterator iter;
 
     /* Pick an area to map */
-    y1 = context->origin->player->grid.y - context->y;
-    y2 = context->origin->player->grid.y + context->y;
-    x1 = context->origin->player->grid.x - context->x;
-    x2 = context->origin->player->grid.x + context->x;
-
-    loc_init(&begin, x1, y1);
-    loc_init(&end, x2, y2);
+    detect_area(context, &begin, &end);
     loc_iterator_first(&iter, &begin, &end);
 
     /* Scan the dungeon */
     do
     {
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
-
         /* Detect traps */
         if (square_isplayertrap(context->cave, &iter.cur))
         {
@@ -3695,7 +3678,6 @@ static bool effect_handler_DETECT_TRAPS(effect_handler_context_t *context)
  */
 static bool effect_handler_DETECT_TREASURES(effect_handler_context_t *context)
 {
-    int x1, x2, y1, y2;
     bool gold_buried = false, objects = false;
     bool full = (context->radius? true: false);
     struct loc begin, end;
@@ -3705,26 +3687,20 @@ static bool effect_handler_DETECT_TREASURES(effect_handler_context_t *context)
     if (context->origin->player->dm_flags & DM_SEE_LEVEL) full = true;
 
     /* Pick an area to map */
-    y1 = context->origin->player->grid.y - context->y;
-    y2 = context->origin->player->grid.y + context->y;
-    x1 = context->origin->player->grid.x - context->x;
-    x2 = context->origin->player->grid.x + context->x;
-
-    loc_init(&begin, x1, y1);
-    loc_init(&end, x2, y2);
+    detect_area(context, &begin, &end);
     loc_iterator_first(&iter, &begin, &end);
 
-    /* Scan the dungeon */
+    /* Scan the dungeon for buried gold and objects */
     do
     {
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
+        struct object *obj;
 
         /* Magma/Quartz + Known Gold */
         if (square_hasgoldvein(context->cave, &iter.cur))
         {
             /* Memorize */
             square_memorize(context->origin->player, context->cave, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
 
             /* Detect */
             gold_buried = true;
@@ -3735,20 +3711,10 @@ static bool effect_handler_DETECT_TREASURES(effect_handler_context_t *context)
             square_isnotknown(context->origin->player, context->cave, &iter.cur))
         {
             square_forget(context->origin->player, &iter.cur);
-            square_light_spot(context->cave, &iter.cur);
+            square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
         }
-    }
-    while (loc_iterator_next(&iter));
-
-    loc_iterator_first(&iter, &begin, &end);
-
-    /* Scan the area for objects */
-    do
-    {
-        struct object *obj;
-
-        if (!square_in_bounds_fully(context->cave, &iter.cur)) continue;
 
+        /* Objects */
         obj = square_object(context->cave, &iter.cur);
 
         /* Skip empty grids */
@@ -3764,7 +3730,7 @@ static bool effect_handler_DETECT_TREASURES(effect_handler_context_t *context)
         /* Memorize the pile */
         if (full) square_know_pile(context->origin->player, context->cave, &iter.cur);
         else square_sense_pile(context->origin->player, context->cave, &iter.cur);
-        square_light_spot(context->cave, &iter.cur);
+        square_light_spot_aux(context->origin->player, context->cave, &iter.cur);
     }
     while (loc_iterator_next(&iter));
 
@@ -6911,8 +6877,9 @@ static bool effect_handler_TELEPORT(effect_handler_context_t *context)
     struct worldpos *wpos;
     int d_min = 0, d_max = 0;
     bool far_location = false;
-    struct loc begin, end;
-    struct loc_iterator iter;
+    struct loc *grids, *spots;
+    int i, num_grids, num_legal = 0;
+    struct loc dest;
 
     /* Hack -- already used up */
     bool used = (context->other == 1);
@@ -7016,28 +6983,30 @@ static bool effect_handler_TELEPORT(effect_handler_context_t *context)
         return !used;
     }
 
-    loc_init(&begin, 1, 1);
-    loc_init(&end, context->cave->width - 1, context->cave->height - 1);
-    loc_iterator_first(&iter, &begin, &end);
+    /* Candidate grids (checked once, the valid ones are remembered for the next passes) */
+    grids = cave_tele_grids(context->cave, &num_grids);
+    spots = mem_alloc(MAX(num_grids, 1) * sizeof(struct loc));
 
     /* Get min/max teleporting distances */
-    do
+    for (i = 0; i < num_grids; i++)
     {
-        int d = distance(&iter.cur, &start);
+        int d = distance(&grids[i], &start);
 
         /* Must move */
         if (d == 0) continue;
 
-        if (!allow_teleport(context->cave, &iter.cur, safe_ghost, is_player)) continue;
+        if (!allow_teleport(context->cave, &grids[i], safe_ghost, is_player)) continue;
+
+        loc_copy(&spots[num_legal++], &grids[i]);
 
         if ((d_min == 0) || (d < d_min)) d_min = d;
         if ((d_max == 0) || (d > d_max)) d_max = d;
     }
-    while (loc_iterator_next_strict(&iter));
 
     /* Report failure (very unlikely) */
     if ((d_min == 0) && (d_max == 0))
     {
+        mem_free(spots);
         if (context->origin->player)
             msg(context->origin->player, "Failed to find teleport destination!");
          return !used;
@@ -7059,73 +7028,52 @@ static bool effect_handler_TELEPORT(effect_handler_context_t *context)
     /* See if we can find a location not too close from previous player location */
     if (is_player)
     {
-        loc_iterator_first(&iter, &begin, &end);
-
-        do
+        for (i = 0; i < num_legal; i++)
         {
-            int d = distance(&iter.cur, &start);
-            int d_old = distance(&iter.cur, &context->origin->player->old_grid);
+            int d = distance(&spots[i], &start);
+            int d_old = distance(&spots[i], &context->origin->player->old_grid);
 
             /* Enforce distance */
             if ((d < d_min) || (d > d_max)) continue;
 
-            if (!allow_teleport(context->cave, &iter.cur, safe_ghost, is_player))
-                continue;
-
             /* Not too close from previous player location */
             if (d_old < d_min) continue;
 
             far_location = true;
             break;
         }
-        while (loc_iterator_next_strict(&iter));
     }
 
-    loc_iterator_first(&iter, &begin, &end);
-
     /* Count valid teleport locations */
-    do
+    for (i = 0; i < num_legal; i++)
     {
-        int d = distance(&iter.cur, &start);
+        int d = distance(&spots[i], &start);
 
         /* Enforce distance */
         if ((d < d_min) || (d > d_max)) continue;
         if (far_location)
         {
-            int d_old = distance(&iter.cur, &context->origin->player->old_grid);
+            int d_old = distance(&spots[i], &context->origin->player->old_grid);
 
             if (d_old < d_min) continue;
         }
 
-        if (!allow_teleport(context->cave, &iter.cur, safe_ghost, is_player)) continue;
-
-        num_spots++;
+        loc_copy(&spots[num_spots++], &spots[i]);
     }
-    while (loc_iterator_next_strict(&iter));
 
-    loc_iterator_first(&iter, &begin, &end);
+    /* Report failure (no valid location in the distance band) */
+    if (!num_spots)
+    {
+        mem_free(spots);
+        if (context->origin->player)
+            msg(context->origin->player, "Failed to find teleport destination!");
+        return !used;
+    }
 
     /* Pick a spot */
     pick = randint0(num_spots);
-    do
-    {
-        int d = distance(&iter.cur, &start);
-
-        /* Enforce distance */
-        if ((d < d_min) || (d > d_max)) continue;
-        if (far_location)
-        {
-            int d_old = distance(&iter.cur, &context->origin->player->old_grid);
-
-            if (d_old < d_min) continue;
-        }
-
-        if (!allow_teleport(context->cave, &iter.cur, safe_ghost, is_player)) continue;
-
-        pick--;
-        if (pick == -1) break;
-    }
-    while (loc_iterator_next_strict(&iter));
+    loc_copy(&dest, &spots[pick]);
+    mem_free(spots);
 
     /* Sound */
     if (context->origin->player)
@@ -7151,14 +7099,14 @@ static bool effect_handler_TELEPORT(effect_handler_context_t *context)
     }
 
     /* Move the target */
-    monster_swap(context->cave, &start, &iter.cur);
+    monster_swap(context->cave, &start, &dest);
 
     /* Clear any projection marker to prevent double processing */
-    sqinfo_off(square(context->cave, &iter.cur)->info, SQUARE_PROJECT);
+    sqinfo_off(square(context->cave, &dest)->info, SQUARE_PROJECT);
 
     /* Clear monster target if it's no longer visible */
     if (context->origin->player && !is_player &&
-        !los(context->cave, &context->origin->player->grid, &iter.cur))
+        !los(context->cave, &context->origin->player->grid, &dest))
     {
         target_set_monster(context->origin->player, NULL);
     }
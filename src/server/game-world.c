@@ -297,19 +297,56 @@ static void play_ambient_sound(struct player *p)
 }
 
 
+/* Values of the "Mortal Wound" grade of cuts */
+static bool mortal_wound_ok = false;
+static int mortal_wound_min, mortal_wound_max;
+
+
 /*
  * Helper for process_player -- decrement p->timed[] and curse effect fields.
  */
 static void decrease_timeouts(struct player *p, struct chunk *c)
 {
     int adjust = (adj_con_fix[p->state.stat_ind[STAT_CON]] + 1);
-    int i;
+    int i, last = -1;
 
-    /* Most timed effects decrement by 1 */
-    for (i = 0; i < TMD_MAX; i++)
+    if (!mortal_wound_ok)
+    {
+        if (!player_timed_grade_range(TMD_CUT, "Mortal Wound", &mortal_wound_min,
+            &mortal_wound_max))
+        {
+            mortal_wound_min = 1;
+            mortal_wound_max = 0;
+        }
+        mortal_wound_ok = true;
+    }
+
+    /*
+     * Most timed effects decrement by 1
+     *
+     * Only the effects listed as active are visited, in increasing order. The list is searched
+     * again after each effect, since decreasing one may start another.
+     */
+    while (true)
     {
-        int decr = 1;
-        if (!p->timed[i]) continue;
+        int decr = 1, pos;
+
+        /* Find the next effect */
+        for (pos = 0; pos < p->num_timed; pos++)
+        {
+            if (p->timed_list[pos] > last) break;
+        }
+        if (pos == p->num_timed) break;
+        i = last = p->timed_list[pos];
+
+        /* Forget expired effects */
+        if (!p->timed[i])
+        {
+            memmove(&p->timed_list[pos], &p->timed_list[pos + 1],
+                (p->num_timed - pos - 1) * sizeof(s16b));
+            p->num_timed--;
+            continue;
+        }
 
         /* Special case */
         if (i == TMD_SAFELOGIN)
@@ -325,7 +362,8 @@ static void decrease_timeouts(struct player *p, struct chunk *c)
             case TMD_CUT:
             {
                 /* Check for truly "mortal" wound */
-                if (player_timed_grade_eq(p, i, "Mortal Wound")) decr = 0;
+                if ((p->timed[i] >= mortal_wound_min) && (p->timed[i] <= mortal_wound_max))
+                    decr = 0;
                 else decr = adjust;
 
                 /* Biofeedback always helps */
@@ -390,9 +428,11 @@ static void decrease_timeouts(struct player *p, struct chunk *c)
     }
 
     /* Spell cooldown */
-    for (i = 0; i < p->clazz->magic.total_spells; i++)
+    for (i = 0; p->num_cooldowns && (i < p->clazz->magic.total_spells); i++)
     {
-        if (p->spell_cooldown[i]) p->spell_cooldown[i]--;
+        if (!p->spell_cooldown[i]) continue;
+        p->spell_cooldown[i]--;
+        if (!p->spell_cooldown[i]) p->num_cooldowns--;
     }
 }
 
@@ -414,7 +454,7 @@ static void process_world(struct player *p, struct chunk *c)
         if (cave_monster_count(c) + 32 > z_info->level_monster_max)
             compact_monsters(c, 64);
 
-        /* Too many holes in the monster list - compress */
+        /* Too many holes at the end of the monster list - trim */
         if (cave_monster_count(c) + 32 < cave_monster_max(c))
             compact_monsters(c, 0);
 
@@ -1741,6 +1781,8 @@ static void generate_new_level(struct player *p)
 
     /* Add the player */
     square_set_mon(c, &p->grid, 0 - id);
+    c->dormant_stamp++;
+    if (p->timed[TMD_ANCHOR]) register_st_anchor(p);
 
     /* Redraw */
     square_light_spot(c, &p->grid);
@@ -1870,7 +1912,7 @@ static void energize_monsters(struct chunk *c)
         energy = frame_energy(mspeed);
 
         /* If we are within a player's time bubble, scale our energy */
-        if (mon->closest_player)
+        if (mon->closest_player && !mon->dormant)
         {
             bool allow_running = (!in_town(&c->wpos) && !monsters_in_los(mon->closest_player, c));
 
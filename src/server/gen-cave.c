@@ -4134,6 +4134,12 @@ struct chunk *lair_gen(struct player *p, struct worldpos *wpos, int min_height,
     }
     player_cave_new(p, y_size, x_size);
     c->width = x_size;
+    actor_cells_reset(c);
+    mem_free(c->tele_grids);
+    c->tele_grids = NULL;
+    c->tele_grids_ok = false;
+    mem_free(c->house_grids);
+    c->house_grids = NULL;
 
     /* Make the level */
     chunk_copy(c, lair, 0, x_size / 2);
@@ -209,7 +209,7 @@ void spread_monsters(struct player *p, struct chunk *c, const char *type, int de
 {
     int i, j;           /* Limits on loops */
     int count;
-    int start_mon_num = c->mon_max;
+    int start_mon_num = cave_monster_count(c);
     struct loc grid;
 
     loc_init(&grid, x0, y0);
@@ -266,7 +266,7 @@ void spread_monsters(struct player *p, struct chunk *c, const char *type, int de
         mon_restrict(p, type, depth, true);
 
         /* Rein in monster groups and escorts a little. */
-        if (c->mon_max - start_mon_num > num * 2) break;
+        if (cave_monster_count(c) - start_mon_num > num * 2) break;
 
         /* Count the monster(s), reset the loop count */
         count++;
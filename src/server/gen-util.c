@@ -146,9 +146,27 @@ void shuffle(int *arr, int n)
 }
 
 
+/*
+ * Number of random probes tried before shuffling the whole rectangle
+ */
+#define FIND_PROBES 10
+
+
+/*
+ * Square indexes reused by cave_find_in_range() to shuffle a rectangle
+ */
+static int *find_squares = NULL;
+static int find_squares_size = 0;
+
+
 /*
  * Locate a square in a rectangle which satisfies the given predicate.
  *
+ * A few random squares are tested first, which is enough most of the time.
+ * Each probe is uniform over the rectangle, so the square found is uniform
+ * over the squares satisfying the predicate, like the exhaustive search that
+ * comes next.
+ *
  * c current chunk
  * grid found grid
  * top_left top left grid of rectangle
@@ -167,9 +185,25 @@ bool cave_find_in_range(struct chunk *c, struct loc *grid, struct loc *top_left,
 
     loc_diff(&diff, bottom_right, top_left);
     n = diff.y * diff.x;
+    if (n <= 0) return false;
 
-    /* Allocate the squares, and randomize their order */
-    squares = mem_alloc(n * sizeof(int));
+    /* Try a few random squares */
+    for (i = 0; i < FIND_PROBES; i++)
+    {
+        int k = randint0(n);
+
+        grid->y = (k / diff.x) + top_left->y;
+        grid->x = (k % diff.x) + top_left->x;
+        if (pred(c, grid)) return true;
+    }
+
+    /* Get the squares, and randomize their order */
+    if (n > find_squares_size)
+    {
+        find_squares = mem_realloc(find_squares, n * sizeof(int));
+        find_squares_size = n;
+    }
+    squares = find_squares;
 
     for (i = 0; i < n; i++) squares[i] = i;
 
@@ -187,13 +221,22 @@ bool cave_find_in_range(struct chunk *c, struct loc *grid, struct loc *top_left,
         if (pred(c, grid)) found = true;
     }
 
-    mem_free(squares);
-
     /* Return whether we found an empty square or not. */
     return found;
 }
 
 
+/*
+ * Free the squares used by cave_find_in_range()
+ */
+void cave_find_cleanup(void)
+{
+    mem_free(find_squares);
+    find_squares = NULL;
+    find_squares_size = 0;
+}
+
+
 /*
  * Locate a square in the dungeon which satisfies the given predicate.
  *
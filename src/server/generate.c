@@ -728,6 +728,7 @@ static void cleanup_template_parser(void)
     cleanup_parser(&profile_parser);
     cleanup_parser(&room_parser);
     cleanup_parser(&vault_parser);
+    cave_find_cleanup();
 }
 
 
@@ -1087,6 +1088,9 @@ void cave_wipe(struct chunk *c)
     /* Clear the monsters */
     wipe_mon_list(c);
 
+    /* Forget the content of player owned stores */
+    house_stock_wipe(&c->wpos);
+
     loc_init(&begin, 0, 0);
     loc_init(&end, c->width, c->height);
     loc_iterator_first(&iter, &begin, &end);
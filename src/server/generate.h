@@ -322,6 +322,7 @@ extern byte get_angle_to_grid[41][41];
 extern int grid_to_i(struct loc *grid, int w);
 extern void i_to_grid(int i, int w, struct loc *grid);
 extern void shuffle(int *arr, int n);
+extern void cave_find_cleanup(void);
 extern bool cave_find_in_range(struct chunk *c, struct loc *grid, struct loc *top_left,
     struct loc *bottom_right, square_predicate pred);
 extern bool find_empty(struct chunk *c, struct loc *grid);
@@ -25,6 +25,31 @@ static size_t num_houses = 0;
 static size_t alloc_houses = 0;
 static size_t num_custom = 0;
 
+/* Bumped when a house is added, resized or removed (see house_at()) */
+static u32b house_stamp = 1;
+
+
+/*
+ * Index of the items offered for sale in player owned stores.
+ *
+ * Each house keeps the list of its items for sale, and all items are also
+ * chained by kind, so that the market can be searched without scanning the
+ * content of every house. A house whose content changes is only marked as
+ * "stale" and queued: its listings are rebuilt the next time they are needed.
+ */
+struct house_stock
+{
+    struct house_listing *items;    /* Items for sale (in house scan order) */
+    char name[NORMAL_WID];          /* Store name */
+    bool named;                     /* Store name was found */
+    bool stale;                     /* Content changed since last indexed */
+};
+
+static struct house_stock *stocks;
+static int *stale_houses;
+static int num_stale = 0;
+static struct house_listing **kind_stock;
+
 
 /*
  * Maximum number of custom houses available.
@@ -39,6 +64,8 @@ void houses_init(void)
 {
     alloc_houses = MAX_HOUSES;
     houses = mem_zalloc(alloc_houses * sizeof(struct house_type));
+    stocks = mem_zalloc(alloc_houses * sizeof(struct house_stock));
+    stale_houses = mem_zalloc(alloc_houses * sizeof(int));
 }
 
 
@@ -47,7 +74,37 @@ void houses_init(void)
  */
 void houses_free(void)
 {
+    size_t i;
+
+    for (i = 0; i < num_houses; i++)
+    {
+        struct house_listing *item = stocks[i].items;
+
+        while (item)
+        {
+            struct house_listing *next = item->next;
+
+            mem_free(item);
+            item = next;
+        }
+    }
+
     mem_free(houses);
+    mem_free(stocks);
+    mem_free(stale_houses);
+    mem_free(kind_stock);
+}
+
+
+/*
+ * Queue a house for reindexing
+ */
+static void house_stock_mark(int house)
+{
+    if (stocks[house].stale) return;
+
+    stocks[house].stale = true;
+    stale_houses[num_stale++] = house;
 }
 
 
@@ -198,6 +255,9 @@ int house_add(bool custom)
             /* Extend the house array */
             alloc_houses += MAX_HOUSES;
             houses = mem_realloc(houses, alloc_houses * sizeof(struct house_type));
+            stocks = mem_realloc(stocks, alloc_houses * sizeof(struct house_stock));
+            stale_houses = mem_realloc(stale_houses, alloc_houses * sizeof(int));
+            memset(&stocks[num_houses], 0, MAX_HOUSES * sizeof(struct house_stock));
         }
 
         /* Increment number of houses */
@@ -217,6 +277,22 @@ void house_set(int slot, struct house_type *house)
     if ((slot < 0) || (slot >= houses_count())) return;
 
     memcpy(&houses[slot], house, sizeof(struct house_type));
+    house_stamp++;
+
+    /* Index the content of the house (later) */
+    house_stock_mark(slot);
+}
+
+
+/*
+ * Notice that a house has been resized
+ */
+void house_resized(int house)
+{
+    house_stamp++;
+
+    /* Index the content of the house (later) */
+    house_stock_mark(house);
 }
 
 
@@ -337,7 +413,9 @@ void wipe_custom_houses(struct worldpos *wpos)
         /* Wipe extended and custom houses */
         if (houses[house].state >= HOUSE_EXTENDED)
         {
+            house_stock_mark(house);
             memset(&houses[house], 0, sizeof(struct house_type));
+            house_stamp++;
             num_custom--;
         }
     }
@@ -470,6 +548,7 @@ void reset_house(int house)
     houses[house].ownerid = 0;
     houses[house].color = 0;
     houses[house].free = 0;
+    house_stock_mark(house);
 
     /* Remove all players from the house */
     for (i = 1; i <= NumPlayers; i++)
@@ -595,43 +674,11 @@ void colorize_door(struct player *p, struct object_kind *kind, struct chunk *c,
  */
 bool get_player_store_name(int num, char *name, int len)
 {
-    struct loc_iterator iter;
-    const char *c;
-    struct chunk *cv = chunk_get(&houses[num].wpos);
-
-    /* Default title */
-    my_strcpy(name, "Shop", len);
-
-    loc_iterator_first(&iter, &houses[num].grid_1, &houses[num].grid_2);
-
-    /* Scan house */
-    do
-    {
-        struct object *obj;
-
-        /* Scan all objects in the grid */
-        for (obj = square_object(cv, &iter.cur); obj; obj = obj->next)
-        {
-            /* If there was an object, does it have a store name? */
-            if (obj->note)
-            {
-                c = my_stristr(quark_str(obj->note), "store name");
-                if (c)
-                {
-                    /* Get name */
-                    c += 10; /* skip "store name" */
-                    if (*c++ == ' ')
-                    {
-                        my_strcpy(name, c, len);
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-    while (loc_iterator_next(&iter));
+    /* Index the content of the house */
+    house_stock_get(num);
 
-    return false;
+    my_strcpy(name, stocks[num].name, len);
+    return stocks[num].named;
 }
 
 
@@ -731,3 +778,299 @@ void memorize_houses(struct player *p)
         while (loc_iterator_next(&iter));
     }
 }
+
+
+/*
+ * Remove the listings of a house from the index
+ */
+static void house_stock_unlist(int house)
+{
+    struct house_listing *item = stocks[house].items;
+
+    while (item)
+    {
+        struct house_listing *next = item->next;
+
+        /* Unlink from the kind list */
+        if (item->prev_kind) item->prev_kind->next_kind = item->next_kind;
+        else kind_stock[item->kind->kidx] = item->next_kind;
+        if (item->next_kind) item->next_kind->prev_kind = item->prev_kind;
+
+        mem_free(item);
+        item = next;
+    }
+
+    stocks[house].items = NULL;
+}
+
+
+/*
+ * Add a listing to its kind list, keeping the list sorted by price
+ */
+static void house_stock_link(struct house_listing *listing)
+{
+    struct house_listing *prev = NULL, *cur = kind_stock[listing->kind->kidx];
+
+    while (cur && (cur->askprice <= listing->askprice))
+    {
+        prev = cur;
+        cur = cur->next_kind;
+    }
+
+    listing->prev_kind = prev;
+    listing->next_kind = cur;
+    if (prev) prev->next_kind = listing;
+    else kind_stock[listing->kind->kidx] = listing;
+    if (cur) cur->prev_kind = listing;
+}
+
+
+/*
+ * Rebuild the listings of a house
+ *
+ * Old listings may point to objects which don't exist anymore, so they are
+ * discarded without being looked at.
+ */
+static void house_stock_refresh(int house)
+{
+    struct house_stock *stock = &stocks[house];
+    struct house_listing **tail = &stock->items;
+    struct chunk *c;
+    struct loc_iterator iter;
+
+    if (!kind_stock) kind_stock = mem_zalloc(z_info->k_max * sizeof(struct house_listing *));
+
+    house_stock_unlist(house);
+    stock->stale = false;
+
+    /* Default title */
+    my_strcpy(stock->name, "Shop", sizeof(stock->name));
+    stock->named = false;
+
+    /* Paranoia */
+    if (!houses[house].state) return;
+    c = chunk_get(&houses[house].wpos);
+    if (!c) return;
+
+    loc_iterator_first(&iter, &houses[house].grid_1, &houses[house].grid_2);
+
+    /* Scan house */
+    do
+    {
+        struct object *obj;
+
+        /* Scan all objects in the grid */
+        for (obj = square_object(c, &iter.cur); obj; obj = obj->next)
+        {
+            struct house_listing *listing;
+            const char *note;
+            s32b price;
+
+            /* Must be inscribed */
+            if (!obj->note) continue;
+            note = quark_str(obj->note);
+
+            /* If there was an object, does it have a store name? */
+            if (!stock->named)
+            {
+                const char *s = my_stristr(note, "store name");
+
+                if (s)
+                {
+                    /* Get name */
+                    s += 10; /* skip "store name" */
+                    if (*s++ == ' ')
+                    {
+                        my_strcpy(stock->name, s, sizeof(stock->name));
+                        stock->named = true;
+                    }
+                }
+            }
+
+            /* Must be for sale */
+            price = get_askprice(note);
+            if (price < 0) continue;
+
+            /* Add a listing */
+            listing = mem_zalloc(sizeof(*listing));
+            listing->obj = obj;
+            listing->kind = obj->kind;
+            listing->askprice = price;
+            listing->house = house;
+            *tail = listing;
+            tail = &listing->next;
+            house_stock_link(listing);
+        }
+    }
+    while (loc_iterator_next(&iter));
+}
+
+
+/*
+ * Reindex all houses whose content has changed
+ */
+static void house_stock_update(void)
+{
+    int i;
+
+    for (i = 0; i < num_stale; i++)
+    {
+        house_stock_refresh(stale_houses[i]);
+    }
+
+    num_stale = 0;
+}
+
+
+/*
+ * Get the house covering a grid of a level, or -1
+ *
+ * The houses covering each grid are indexed when needed, and again after a house has been
+ * added, resized or removed.
+ */
+static int house_at(struct chunk *c, struct loc *grid)
+{
+    if (!c->house_grids || (c->house_stamp != house_stamp))
+    {
+        int house;
+
+        if (!c->house_grids) c->house_grids = mem_alloc(c->height * c->width * sizeof(int));
+        memset(c->house_grids, 0, c->height * c->width * sizeof(int));
+
+        /* Lower indexes go last, so they win where houses overlap */
+        for (house = houses_count() - 1; house >= 0; house--)
+        {
+            struct loc begin, end;
+            struct loc_iterator iter;
+
+            if (!houses[house].state || !wpos_eq(&houses[house].wpos, &c->wpos)) continue;
+
+            loc_init(&begin, MAX(houses[house].grid_1.x, 0), MAX(houses[house].grid_1.y, 0));
+            loc_init(&end, MIN(houses[house].grid_2.x, c->width - 1),
+                MIN(houses[house].grid_2.y, c->height - 1));
+            if ((begin.x > end.x) || (begin.y > end.y)) continue;
+            loc_iterator_first(&iter, &begin, &end);
+
+            do
+            {
+                c->house_grids[iter.cur.y * c->width + iter.cur.x] = house + 1;
+            }
+            while (loc_iterator_next(&iter));
+        }
+
+        c->house_stamp = house_stamp;
+    }
+
+    return c->house_grids[grid->y * c->width + grid->x] - 1;
+}
+
+
+/*
+ * Notice that the content of a house may have changed
+ */
+void house_stock_changed(struct worldpos *wpos, struct loc *grid)
+{
+    struct chunk *c;
+    int house;
+
+    /* Houses are only found on the surface */
+    if (wpos->depth > 0) return;
+
+    /* Look the grid up in the level */
+    c = chunk_get(wpos);
+    if (c && square_in_bounds(c, grid))
+    {
+        house = house_at(c, grid);
+        if (house >= 0) house_stock_mark(house);
+        return;
+    }
+
+    for (house = 0; house < houses_count(); house++)
+    {
+        if (houses[house].state && wpos_eq(&houses[house].wpos, wpos) &&
+            loc_between(grid, &houses[house].grid_1, &houses[house].grid_2))
+        {
+            house_stock_mark(house);
+            return;
+        }
+    }
+}
+
+
+/*
+ * Forget the content of the houses on a level (the level is deallocated)
+ */
+void house_stock_wipe(struct worldpos *wpos)
+{
+    int house;
+
+    /* Houses are only found on the surface */
+    if (wpos->depth > 0) return;
+
+    for (house = 0; house < houses_count(); house++)
+    {
+        if (houses[house].state && wpos_eq(&houses[house].wpos, wpos))
+            house_stock_mark(house);
+    }
+}
+
+
+/*
+ * Get the items offered for sale in a player owned store
+ */
+struct house_listing *house_stock_get(int house)
+{
+    house_stock_update();
+
+    return stocks[house].items;
+}
+
+
+/*
+ * Get the items of a given kind offered for sale in player owned stores, by increasing price
+ */
+struct house_listing *house_stock_kind(struct object_kind *kind)
+{
+    house_stock_update();
+
+    if (!kind_stock) return NULL;
+    return kind_stock[kind->kidx];
+}
+
+
+/*
+ * List the items offered for sale in player owned stores in a file
+ */
+void house_stock_list(struct player *p, ang_file *fff)
+{
+    int i, j = 0;
+    char o_name[NORMAL_WID];
+    char buf[160];
+    char dpt[13];
+
+    for (i = 0; i < z_info->k_max; i++)
+    {
+        struct house_listing *item;
+
+        for (item = house_stock_kind(&k_info[i]); item; item = item->next_kind)
+        {
+            struct object *copy = object_new();
+
+            /* Describe the item as it would be in the store */
+            object_copy(copy, item->obj);
+            object_notice_everything_aux(p, copy, true, false);
+            copy->note = 0;
+            object_desc(p, o_name, sizeof(o_name), copy, ODESC_PREFIX | ODESC_FULL);
+            object_delete(&copy);
+
+            dpt[0] = '\0';
+            wild_cat_depth(&houses[item->house].wpos, dpt, sizeof(dpt));
+
+            strnfmt(buf, sizeof(buf), "  %s: %ld gold%s (%s, %s)\n", o_name, (long)item->askprice,
+                ((item->obj->number > 1)? " each": ""), stocks[item->house].name, dpt);
+            file_put(fff, buf);
+            j++;
+        }
+    }
+    if (!j) file_put(fff, "No item is offered for sale in player owned stores.\n");
+}
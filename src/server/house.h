@@ -29,6 +29,18 @@ struct house_type
     byte free;                  /* House is free (bought with a Deed of Property) */
 };
 
+/* An item offered for sale in a player owned store */
+struct house_listing
+{
+    struct object *obj;                 /* Object on the floor of the house */
+    struct object_kind *kind;           /* Kind of the object */
+    s32b askprice;                      /* Asking price (for one item) */
+    int house;                          /* House index */
+    struct house_listing *next;         /* Next item in the same house */
+    struct house_listing *next_kind;    /* Next item of the same kind (by increasing price) */
+    struct house_listing *prev_kind;    /* Previous item of the same kind */
+};
+
 /* Initialize the house package */
 extern void houses_init(void);
 
@@ -108,4 +120,22 @@ extern bool house_extend(void);
 /* Memorize the content of owned houses */
 extern void memorize_houses(struct player *p);
 
+/* Notice that a house has been resized */
+extern void house_resized(int house);
+
+/* Notice that the content of a house may have changed */
+extern void house_stock_changed(struct worldpos *wpos, struct loc *grid);
+
+/* Forget the content of the houses on a level */
+extern void house_stock_wipe(struct worldpos *wpos);
+
+/* Get the items offered for sale in a player owned store */
+extern struct house_listing *house_stock_get(int house);
+
+/* Get the items of a given kind offered for sale in player owned stores */
+extern struct house_listing *house_stock_kind(struct object_kind *kind);
+
+/* List the items offered for sale in player owned stores in a file */
+extern void house_stock_list(struct player *p, ang_file *fff);
+
 #endif /* INCLUDED_HOUSE_H */
@@ -82,6 +82,7 @@ bool cfg_gold_drop_vanilla = true;
 bool cfg_no_ghost = false;
 bool cfg_ai_learn = true;
 bool cfg_challenging_levels = false;
+s16b cfg_dormant_range = 40;
 
 
 static const char *slots[] =
@@ -4231,9 +4232,11 @@ extern struct init_module z_quark_module;
 extern struct init_module generate_module;
 extern struct init_module rune_module;
 extern struct init_module mon_make_module;
+extern struct init_module mon_spell_module;
 extern struct init_module obj_make_module;
 extern struct init_module ignore_module;
 extern struct init_module store_module;
+extern struct init_module project_module;
 extern struct init_module ui_visuals_module;
 
 
@@ -4241,6 +4244,7 @@ static struct init_module *modules[] =
 {
     &z_quark_module,
     &ui_visuals_module, /* This needs to load before monsters and objects. */
+    &mon_spell_module,  /* This needs to load before monsters. */
     &arrays_module,
     &generate_module,
     &rune_module,
@@ -4248,6 +4252,7 @@ static struct init_module *modules[] =
     &obj_make_module,
     &ignore_module,
     &store_module,
+    &project_module,
     NULL
 };
 
@@ -4621,6 +4626,13 @@ static void set_server_option(const char *option, char *value)
         cfg_ai_learn = str_to_boolean(value);
     else if (!strcmp(option, "CHALLENGING_LEVELS"))
         cfg_challenging_levels = str_to_boolean(value);
+    else if (!strcmp(option, "DORMANT_RANGE"))
+    {
+        cfg_dormant_range = atoi(value);
+
+        /* Sanity checks */
+        if (cfg_dormant_range < 0) cfg_dormant_range = 0;
+    }
     else plog_fmt("Error : unrecognized mangband.cfg option %s", option);
 }
 
@@ -1531,6 +1531,32 @@ static void do_cmd_knowledge_houses(struct player *p, int line)
 }
 
 
+/*
+ * Display items offered for sale in player owned stores
+ */
+static void do_cmd_knowledge_market(struct player *p, int line)
+{
+    char file_name[MSG_LEN];
+    ang_file *fff;
+
+    /* Temporary file */
+    fff = file_temp(file_name, sizeof(file_name));
+    if (!fff) return;
+
+    /* List items for sale */
+    house_stock_list(p, fff);
+
+    /* Close the file */
+    file_close(fff);
+
+    /* Display the file contents */
+    show_file(p, file_name, "Player Store Items", line, 0);
+
+    /* Remove the file */
+    file_delete(file_name);
+}
+
+
 /*
  * Display visited dungeons and towns
  */
@@ -1654,6 +1680,13 @@ void do_cmd_knowledge(struct player *p, char type, int line)
             do_cmd_knowledge_dungeons(p, line);
             Send_term_info(p, NTERM_ACTIVATE, NTERM_WIN_OVERHEAD);
             break;
+
+        /* Display items for sale in player owned stores */
+        case SPECIAL_FILE_MARKET:
+            Send_term_info(p, NTERM_ACTIVATE, NTERM_WIN_SPECIAL);
+            do_cmd_knowledge_market(p, line);
+            Send_term_info(p, NTERM_ACTIVATE, NTERM_WIN_OVERHEAD);
+            break;
     }
 }
 
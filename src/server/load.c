@@ -1067,7 +1067,7 @@ static int rd_store(struct player *p, struct store **store, store_carry_t store_
 /*
  * Read store contents
  */
-static int rd_stores_aux(rd_item_t rd_item_version)
+static int rd_stores_aux(rd_item_t rd_item_version, bool maint)
 {
     int i;
     u16b tmp16u;
@@ -1081,6 +1081,15 @@ static int rd_stores_aux(rd_item_t rd_item_version)
 
         if (res) return res;
 
+        /* Read the missed maintenance passes */
+        if (maint)
+        {
+            s16b pending;
+
+            rd_s16b(&pending);
+            store->maint_pending = pending;
+        }
+
     }
 
     /* Read the store orders */
@@ -1099,7 +1108,8 @@ static int rd_stores_aux(rd_item_t rd_item_version)
 /*
  * Read the stores - wrapper function
  */
-int rd_stores(struct player *unused) {return rd_stores_aux(rd_item);}
+int rd_stores_1(struct player *unused) {return rd_stores_aux(rd_item, false);}
+int rd_stores(struct player *unused) {return rd_stores_aux(rd_item, true);}
 
 
 /*
@@ -1388,7 +1398,10 @@ static int rd_player_objects_aux(struct player *p, rd_item_t rd_item_version)
 
         /* Place object in player object list */
         if (player_square_in_bounds_fully(p, &obj->grid))
+        {
             pile_insert_end(&square_p(p, &obj->grid)->obj, obj);
+            square_note_pile(p, &obj->grid);
+        }
     }
 
     return 0;
@@ -253,18 +253,21 @@ static int choose_attack_spell(bitflag *f, bool innate)
 {
     int num = 0;
     byte spells[RSF_MAX];
+    bitflag innate_spells[RSF_SIZE], choice[RSF_SIZE];
     int i;
 
     /* Paranoid initialization */
     for (i = 0; i < RSF_MAX; i++) spells[i] = 0;
 
-    /* Extract spells, filtering as necessary */
-    for (i = FLAG_START; i < RSF_MAX; i++)
-    {
-        if (!innate && mon_spell_is_innate(i)) continue;
-        if (innate && !mon_spell_is_innate(i)) continue;
-        if (rsf_has(f, i)) spells[num++] = i;
-    }
+    /* Filter spells */
+    create_mon_spell_mask(innate_spells, RST_INNATE, RST_NONE);
+    rsf_copy(choice, f);
+    if (innate) rsf_inter(choice, innate_spells);
+    else rsf_diff(choice, innate_spells);
+
+    /* Extract spells */
+    for (i = rsf_next(choice, FLAG_START); i != FLAG_END; i = rsf_next(choice, i + 1))
+        spells[num++] = i;
 
     /* Pick at random */
     return (spells[randint0(num)]);
@@ -335,7 +338,7 @@ static int get_thrown_spell(struct player *p, struct player *who, struct chunk *
             ignore_spells(f, RST_BOLT);
 
         /* Check for a possible summon */
-        if (!summon_possible(c, &mon->grid))
+        if (test_spells(f, RST_SUMMON) && !summon_possible(c, &mon->grid))
             ignore_spells(f, RST_SUMMON);
     }
 
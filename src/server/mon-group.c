@@ -95,6 +95,46 @@ static void monster_group_split(struct chunk *c, struct monster_group *group)
 }
 
 
+/*
+ * Verify the integrity of a monster group
+ */
+static void monster_group_verify(struct chunk *c, struct monster_group *group)
+{
+    int i = group->index;
+    struct mon_group_list_entry *entry = group->member_list;
+
+    while (entry)
+    {
+        struct monster *mon = cave_monster(c, entry->midx);
+        struct monster_group_info *info = mon->group_info;
+
+        if (info[PRIMARY_GROUP].index != i)
+        {
+            if (info[SUMMON_GROUP].index)
+            {
+                if (info[SUMMON_GROUP].index != i)
+                {
+                    quit_fmt("Bad group index: group: %d, monster: %d", i,
+                        info[SUMMON_GROUP].index);
+                }
+                if (info[SUMMON_GROUP].role != MON_GROUP_LEADER)
+                {
+                    quit_fmt("Bad monster role: group: %d, monster: %d", i,
+                        info[SUMMON_GROUP].index);
+                }
+            }
+            else
+            {
+                quit_fmt("Bad group index: group: %d, monster: %d", i,
+                    info[PRIMARY_GROUP].index);
+            }
+        }
+
+        entry = entry->next;
+    }
+}
+
+
 /*
  * Handle the leader of a group being removed
  */
@@ -134,6 +174,10 @@ static void monster_group_remove_leader(struct chunk *c, struct monster *leader,
         monster_group_split(c, group);
         c->monster_groups[group->index] = NULL;
         monster_group_free(group);
+
+        /* New groups were made, check them all */
+        monster_groups_verify(c);
+        return;
     }
 
     /* If there is a successor, appoint them and finalise changes */
@@ -157,7 +201,7 @@ static void monster_group_remove_leader(struct chunk *c, struct monster *leader,
         }
     }
 
-    monster_groups_verify(c);
+    monster_group_verify(c, group);
 }
 
 
@@ -193,6 +237,7 @@ void monster_remove_from_groups(struct chunk *c, struct monster *mon)
             else
             {
                 group->member_list = list_entry->next;
+                group->size--;
                 mem_free(list_entry);
                 if (group->leader == mon->midx) monster_group_remove_leader(c, mon, group);
             }
@@ -212,6 +257,7 @@ void monster_remove_from_groups(struct chunk *c, struct monster *mon)
                 struct mon_group_list_entry *remove = list_entry->next;
 
                 list_entry->next = list_entry->next->next;
+                group->size--;
                 mem_free(remove);
                 if (group->leader == mon->midx) monster_group_remove_leader(c, mon, group);
                 break;
@@ -220,7 +266,12 @@ void monster_remove_from_groups(struct chunk *c, struct monster *mon)
         }
     }
 
-    monster_groups_verify(c);
+    /* Check the groups the monster was in (only those still around) */
+    for (i = 0; i < GROUP_MAX; i++)
+    {
+        group = c->monster_groups[mon->group_info[i].index];
+        if (group) monster_group_verify(c, group);
+    }
 }
 
 
@@ -256,6 +307,7 @@ void monster_add_to_group(struct monster *mon, struct monster_group *group)
     list_entry->midx = mon->midx;
     list_entry->next = group->member_list;
     group->member_list = list_entry;
+    group->size++;
 }
 
 
@@ -278,6 +330,7 @@ void monster_group_start(struct chunk *c, struct monster *mon, int which)
     group->leader = mon->midx;
     group->member_list = mem_zalloc(sizeof(struct mon_group_list_entry));
     group->member_list->midx = mon->midx;
+    group->size = 1;
 
     /* Write the index to the monster's group info, make it leader */
     mon->group_info[which].index = index;
@@ -339,6 +392,7 @@ void monster_group_assign(struct chunk *c, struct monster *mon, struct monster_g
             entry->midx = mon->midx;
             entry->next = group->member_list;
             group->member_list = entry;
+            group->size++;
         }
     }
 }
@@ -362,47 +416,6 @@ struct monster_group *monster_group_by_index(struct chunk *c, int index)
 }
 
 
-/*
- * Change the group record of the index of a monster (for one or two groups)
- */
-bool monster_group_change_index(struct chunk *c, int new_index, int old_index)
-{
-    int index0 = cave_monster(c, old_index)->group_info[PRIMARY_GROUP].index;
-    int index1 = cave_monster(c, old_index)->group_info[SUMMON_GROUP].index;
-    struct monster_group *group0 = monster_group_by_index(c, index0);
-    struct monster_group *group1 = monster_group_by_index(c, index1);
-    struct mon_group_list_entry *entry = group0->member_list;
-
-    if (group0->leader == old_index) group0->leader = new_index;
-    while (entry)
-    {
-        if (entry->midx == old_index)
-        {
-            entry->midx = new_index;
-            if (!group1) return true;
-        }
-        entry = entry->next;
-    }
-
-    if (group1)
-    {
-        if (group1->leader == old_index) group1->leader = new_index;
-        entry = group1->member_list;
-        while (entry)
-        {
-            if (entry->midx == old_index)
-            {
-                entry->midx = new_index;
-                return true;
-            }
-            entry = entry->next;
-        }
-    }
-
-    return false;
-}
-
-
 /*
  * Get the group of summons of a monster
  */
@@ -463,18 +476,10 @@ void monster_group_rouse(struct player *p, struct chunk *c, struct monster *mon)
  */
 int monster_primary_group_size(struct chunk *c, const struct monster *mon)
 {
-    int count = 0;
     int index = mon->group_info[PRIMARY_GROUP].index;
     struct monster_group *group = c->monster_groups[index];
-    struct mon_group_list_entry *entry = group->member_list;
-
-    while (entry)
-    {
-        count++;
-        entry = entry->next;
-    }
 
-    return count;
+    return group->size;
 }
 
 
@@ -533,40 +538,6 @@ void monster_groups_verify(struct chunk *c)
 
     for (i = 0; i < z_info->level_monster_max; i++)
     {
-        if (c->monster_groups[i])
-        {
-            struct monster_group *group = c->monster_groups[i];
-            struct mon_group_list_entry *entry = group->member_list;
-
-            while (entry)
-            {
-                struct monster *mon = cave_monster(c, entry->midx);
-                struct monster_group_info *info = mon->group_info;
-
-                if (info[PRIMARY_GROUP].index != i)
-                {
-                    if (info[SUMMON_GROUP].index)
-                    {
-                        if (info[SUMMON_GROUP].index != i)
-                        {
-                            quit_fmt("Bad group index: group: %d, monster: %d", i,
-                                info[SUMMON_GROUP].index);
-                        }
-                        if (info[SUMMON_GROUP].role != MON_GROUP_LEADER)
-                        {
-                            quit_fmt("Bad monster role: group: %d, monster: %d", i,
-                                info[SUMMON_GROUP].index);
-                        }
-                    }
-                    else
-                    {
-                        quit_fmt("Bad group index: group: %d, monster: %d", i,
-                            info[PRIMARY_GROUP].index);
-                    }
-                }
-
-                entry = entry->next;
-            }
-        }
+        if (c->monster_groups[i]) monster_group_verify(c, c->monster_groups[i]);
     }
 }
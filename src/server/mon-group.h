@@ -17,6 +17,7 @@ struct monster_group
     int index;
     int leader;
     struct mon_group_list_entry *member_list;
+    int size;   /* Number of entries in the member list */
 };
 
 extern struct monster_group *monster_group_new(void);
@@ -29,7 +30,6 @@ extern void monster_group_assign(struct chunk *c, struct monster *mon,
     struct monster_group_info *info, bool loading);
 extern int monster_group_index(struct monster_group *group);
 extern struct monster_group *monster_group_by_index(struct chunk *c, int index);
-extern bool monster_group_change_index(struct chunk *c, int new_index, int old_index);
 extern struct monster_group *summon_group(struct chunk *c, struct monster *mon);
 extern void monster_group_rouse(struct player *p, struct chunk *c, struct monster *mon);
 extern int monster_primary_group_size(struct chunk *c, const struct monster *mon);
@@ -132,77 +132,169 @@ void monster_list_reset(struct player *p, monster_list_t *list)
 
 
 /*
- * Collect monster information from the current cave's monster list.
+ * Mark the monster census of a chunk as out of date. This must be called when a monster
+ * is placed, moved to another index or changes race. Dead monsters are simply skipped
+ * when the census is used.
  */
-void monster_list_collect(struct player *p, monster_list_t *list)
+void monster_census_invalidate(struct chunk *c)
 {
-	int i;
-    struct chunk *c = chunk_get(&p->wpos);
+    if (c && c->census) c->census->stale = true;
+}
 
-	if (!monster_list_can_update(list, c)) return;
 
-	/* Use cave_monster_max() here in case the monster list isn't compacted. */
-	for (i = 1; i < cave_monster_max(c); i++)
+/*
+ * Free a monster census.
+ */
+void monster_census_free(struct monster_census *census)
+{
+    if (census == NULL) return;
+
+    mem_free(census->midx);
+    mem_free(census->races);
+    mem_free(census->start);
+    mem_free(census->race_group);
+    mem_free(census);
+}
+
+
+/*
+ * Return the monster census of a chunk, taking it again if needed.
+ */
+static struct monster_census *monster_census_take(struct chunk *c)
+{
+    struct monster_census *census = c->census;
+    int i, g, num = 0;
+
+    if (census == NULL)
+    {
+        census = mem_zalloc(sizeof(*census));
+        census->midx = mem_zalloc(z_info->level_monster_max * sizeof(s16b));
+        census->races = mem_zalloc(z_info->level_monster_max * sizeof(struct monster_race *));
+        census->start = mem_zalloc((z_info->level_monster_max + 1) * sizeof(int));
+        census->race_group = mem_zalloc(z_info->r_max * sizeof(int));
+        census->stale = true;
+        c->census = census;
+    }
+
+    /* The census is still valid for this turn */
+    if (!census->stale && (ht_cmp(&census->stamp, &turn) == 0)) return census;
+
+    /* Count the monsters of each race, assigning a group to each new race */
+    census->num_races = 0;
+    for (i = 1; i < cave_monster_max(c); i++)
+    {
+        struct monster *mon = cave_monster(c, i);
+
+        /* Skip dead monsters */
+        if (!mon->race) continue;
+
+        g = census->race_group[mon->race->ridx];
+        if (!g)
+        {
+            census->races[census->num_races] = mon->race;
+            census->start[census->num_races] = 0;
+            census->num_races++;
+            g = census->num_races;
+            census->race_group[mon->race->ridx] = g;
+        }
+        census->start[g - 1]++;
+        num++;
+    }
+
+    /* Turn the counts into the end position of each group */
+    for (g = 1; g < census->num_races; g++) census->start[g] += census->start[g - 1];
+    census->start[census->num_races] = num;
+
+    /* Fill each group backwards, leaving its position at the start of the group */
+    for (i = cave_monster_max(c) - 1; i > 0; i--)
     {
-		struct monster *mon = cave_monster(c, i);
-		monster_list_entry_t *entry = NULL;
-		int j, field;
-		bool los = false;
+        struct monster *mon = cave_monster(c, i);
 
         /* Skip dead monsters */
         if (!mon->race) continue;
 
-		/* Only consider visible, known monsters */
-        if (!monster_is_obvious(p, i, mon)) continue;
+        g = census->race_group[mon->race->ridx] - 1;
+        census->start[g]--;
+        census->midx[census->start[g]] = i;
+    }
+
+    /* Clear the race index for the next census */
+    for (g = 0; g < census->num_races; g++) census->race_group[census->races[g]->ridx] = 0;
+
+    ht_copy(&census->stamp, &turn);
+    census->stale = false;
+
+    return census;
+}
+
+
+/*
+ * Collect monster information from the current cave's monster census.
+ */
+void monster_list_collect(struct player *p, monster_list_t *list)
+{
+	int g, i;
+    struct chunk *c = chunk_get(&p->wpos);
+    struct monster_census *census;
+
+	if (!monster_list_can_update(list, c)) return;
+
+    census = monster_census_take(c);
 
-		/* Find or add a list entry. */
-		for (j = 0; j < (int)list->entries_size; j++)
+    /* Each race group of the census gives at most one entry */
+    for (g = 0; g < census->num_races; g++)
+    {
+        struct monster_race *race = census->races[g];
+        monster_list_entry_t *entry = NULL;
+
+        for (i = census->start[g]; i < census->start[g + 1]; i++)
         {
-			if (list->entries[j].race == NULL)
+            int m_idx = census->midx[i];
+            struct monster *mon = cave_monster(c, m_idx);
+            int field;
+            bool los = false;
+
+            /* Skip monsters killed since the census was taken */
+            if (mon->race != race) continue;
+
+            /* Only consider visible, known monsters */
+            if (!monster_is_obvious(p, m_idx, mon)) continue;
+
+            /* Add a list entry */
+            if (entry == NULL)
             {
-				/* We found an empty slot, so add this race here. */
-                entry = &list->entries[j];
+                entry = &list->entries[list->distinct_entries];
                 memset(entry, 0, sizeof(monster_list_entry_t));
-				entry->race = mon->race;
-				break;
-			}
-			else if (list->entries[j].race == mon->race)
-            {
-				/* We found a matching race and we'll use that. */
-				entry = &list->entries[j];
-				break;
-			}
-		}
-
-		if (entry == NULL) continue;
-
-        /* Always collect the latest monster attribute so that flicker animation works. */
-        if (p->tile_distorted)
-            entry->attr = mon->race->d_attr;
-        else if (mon->attr)
-            entry->attr = mon->attr;
-        else
-            entry->attr = p->r_attr[mon->race->ridx];
-
-		/* Check for LOS using projectable() */
-		los = (projectable(p, c, &p->grid, &mon->grid, PROJECT_NONE, true) &&
-            monster_is_in_view(p, i));
-		field = (los? MONSTER_LIST_SECTION_LOS: MONSTER_LIST_SECTION_ESP);
-		entry->count[field]++;
-
-		if (mon->m_timed[MON_TMD_SLEEP] > 0)
-			entry->asleep[field]++;
-
-		/* Store the location offset from the player; this is only used for monster counts of 1 */
-		entry->dx[field] = mon->grid.x - p->grid.x;
-		entry->dy[field] = mon->grid.y - p->grid.y;
-	}
+                entry->race = race;
+                list->distinct_entries++;
+            }
+
+            /* Always collect the latest monster attribute so that flicker animation works. */
+            if (p->tile_distorted)
+                entry->attr = race->d_attr;
+            else if (mon->attr)
+                entry->attr = mon->attr;
+            else
+                entry->attr = p->r_attr[race->ridx];
+
+            /* Check for LOS using the view flag first, then projectable() */
+            los = (monster_is_in_view(p, m_idx) &&
+                projectable(p, c, &p->grid, &mon->grid, PROJECT_NONE, true));
+            field = (los? MONSTER_LIST_SECTION_LOS: MONSTER_LIST_SECTION_ESP);
+            entry->count[field]++;
+
+            if (mon->m_timed[MON_TMD_SLEEP] > 0)
+                entry->asleep[field]++;
+
+            /* Store the location offset from the player; this is only used for monster counts of 1 */
+            entry->dx[field] = mon->grid.x - p->grid.x;
+            entry->dy[field] = mon->grid.y - p->grid.y;
+        }
+    }
 
 	/* Collect totals for easier calculations of the list. */
-	for (i = 0; i < (int)list->entries_size; i++)
+	for (i = 0; i < list->distinct_entries; i++)
     {
-		if (list->entries[i].race == NULL) continue;
-
 		if (list->entries[i].count[MONSTER_LIST_SECTION_LOS] > 0)
 			list->total_entries[MONSTER_LIST_SECTION_LOS]++;
 
@@ -213,7 +305,6 @@ void monster_list_collect(struct player *p, monster_list_t *list)
             list->entries[i].count[MONSTER_LIST_SECTION_LOS];
 		list->total_monsters[MONSTER_LIST_SECTION_ESP] +=
             list->entries[i].count[MONSTER_LIST_SECTION_ESP];
-		list->distinct_entries++;
 	}
 
     list->sorted = false;
@@ -22,6 +22,21 @@ typedef struct monster_list_entry_s
 	byte attr;
 } monster_list_entry_t;
 
+/*
+ * Census of the live monsters of a chunk, grouped by race. It is taken at most once
+ * per game turn and shared by the monster lists of all the players on the level.
+ */
+struct monster_census
+{
+    hturn stamp;                    /* Game turn the census was taken */
+    bool stale;                     /* The census must be taken again */
+    s16b *midx;                     /* Monster indexes, grouped by race */
+    struct monster_race **races;    /* Race of each group */
+    int *start;                     /* Position of each group in the index list */
+    int num_races;                  /* Number of groups */
+    int *race_group;                /* Group (+1) of each race while taking the census */
+};
+
 typedef struct monster_list_s
 {
 	monster_list_entry_t *entries;
@@ -32,6 +47,8 @@ typedef struct monster_list_s
 	u16b total_monsters[MONSTER_LIST_SECTION_MAX];
 } monster_list_t;
 
+extern void monster_census_invalidate(struct chunk *c);
+extern void monster_census_free(struct monster_census *census);
 extern monster_list_t *monster_list_new(struct player *p);
 extern void monster_list_free(monster_list_t *list);
 extern void monster_list_init(struct player *p);
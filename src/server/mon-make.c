@@ -41,6 +41,10 @@ static s16b alloc_race_size;
 static alloc_entry *alloc_race_table;
 
 
+/* Last generation given to a new monster (monster slots are reused) */
+static u32b monster_generation;
+
+
 /*
  * Initialize monster allocation info
  */
@@ -645,6 +649,9 @@ void delete_monster_idx(struct chunk *c, int m_idx)
     /* Count monsters */
     c->mon_cnt--;
 
+    /* The slot can be reused */
+    c->mon_free[c->num_free++] = m_idx;
+
     /* Visual update */
     square_light_spot(c, &grid);
 }
@@ -667,92 +674,13 @@ void delete_monster(struct chunk *c, struct loc *grid)
 
 
 /*
- * Move a monster from index i1 to index i2 in the monster list.
- *
- * This should only be called when there is an actual monster at i1
- */
-static void monster_index_move(struct chunk *c, int i1, int i2)
-{
-    int i;
-    struct monster *mon, *newmon;
-    struct object *obj;
-    struct source mon1_body;
-    struct source *mon1 = &mon1_body;
-    struct source mon2_body;
-    struct source *mon2 = &mon2_body;
-    struct monster_blow *blows;
-
-    /* Do nothing */
-    if (i1 == i2) return;
-
-    /* Old monster */
-    mon = cave_monster(c, i1);
-    if (!mon) return;
-    source_monster(mon1, mon);
-
-    /* New monster */
-    newmon = cave_monster(c, i2);
-    source_monster(mon2, newmon);
-
-    /* Update the cave */
-    square_set_mon(c, &mon->grid, i2);
-
-    /* Update midx */
-    mon->midx = i2;
-
-    /* Update group */
-    if (!monster_group_change_index(c, i2, i1))
-        quit("Bad monster group info!");
-
-    /* Repair objects being carried by monster */
-    for (obj = mon->held_obj; obj; obj = obj->next)
-        obj->held_m_idx = i2;
-
-    /* Move mimicked objects */
-    if (mon->mimicked_obj)
-        mon->mimicked_obj->mimicking_m_idx = i2;
-
-    /* Copy the visibility and los flags for the players */
-    for (i = 1; i <= NumPlayers; i++)
-    {
-        struct player *p = player_get(i);
-        struct source *health_who = &p->upkeep->health_who;
-
-        /* If he's not here, skip him */
-        if (!wpos_eq(&p->wpos, &c->wpos)) continue;
-
-        mflag_copy(p->mflag[i2], p->mflag[i1]);
-        p->mon_det[i2] = p->mon_det[i1];
-
-        /* Update the target */
-        if (target_equals(p, mon1)) target_set_monster(p, mon2);
-
-        /* Update the health bar */
-        if (source_equal(health_who, mon1)) health_track(p->upkeep, mon2);
-    }
-
-    /* Move monster */
-    blows = newmon->blow;
-    memcpy(newmon, mon, sizeof(struct monster));
-    newmon->blow = blows;
-    if (!newmon->blow)
-        newmon->blow = mem_zalloc(z_info->mon_blows_max * sizeof(struct monster_blow));
-    memcpy(newmon->blow, mon->blow, z_info->mon_blows_max * sizeof(struct monster_blow));
-
-    /* Wipe hole */
-    mem_free(mon->blow);
-    memset(mon, 0, sizeof(struct monster));
-}
-
-
-/*
- * Compacts and reorders the monster list.
- *
- * This function can be very dangerous, use with caution!
+ * Compacts the monster list.
  *
- * When `num_to_compact` is 0, we just reorder the monsters into a more compact
- * order, eliminating any "holes" left by dead monsters. If `num_to_compact` is
- * positive, then we delete at least that many monsters and then reorder.
+ * Monsters never change index: the slots of dead monsters are kept on a free
+ * list and reused by mon_pop(), so there's no need to fill the "holes" left by
+ * dead monsters. When `num_to_compact` is 0, we just trim the dead monsters at
+ * the end of the list. If `num_to_compact` is positive, then we delete at least
+ * that many monsters and then trim the list.
  * We try not to delete monsters that are high level or close to the player.
  * Each time we make a full pass through the monster list, if we haven't
  * deleted enough monsters, we relax our bounds a little to accept
@@ -761,7 +689,7 @@ static void monster_index_move(struct chunk *c, int i1, int i2)
  */
 void compact_monsters(struct chunk *c, int num_to_compact)
 {
-    int m_idx, num_compacted, iter;
+    int m_idx, num_compacted, iter, i, n, old_max = cave_monster_max(c);
     int max_lev, min_dis, chance;
 
     /* Message (only if compacting) */
@@ -813,20 +741,17 @@ void compact_monsters(struct chunk *c, int num_to_compact)
         }
     }
 
-    /* Excise dead monsters (backwards!) */
-    for (m_idx = cave_monster_max(c) - 1; m_idx >= 1; m_idx--)
-    {
-        struct monster *mon = cave_monster(c, m_idx);
-
-        /* Skip real monsters */
-        if (mon->race) continue;
-
-        /* Move last monster into open hole */
-        monster_index_move(c, cave_monster_max(c) - 1, m_idx);
-
-        /* Compress "cave->mon_max" */
+    /* Trim dead monsters at the end of the list */
+    while ((cave_monster_max(c) > 1) && !cave_monster(c, cave_monster_max(c) - 1)->race)
         c->mon_max--;
+
+    /* Forget the free slots past the end of the list */
+    if (cave_monster_max(c) == old_max) return;
+    for (i = 0, n = 0; i < c->num_free; i++)
+    {
+        if (c->mon_free[i] < c->mon_max) c->mon_free[n++] = c->mon_free[i];
     }
+    c->num_free = n;
 }
 
 
@@ -900,6 +825,7 @@ void wipe_mon_list(struct chunk *c)
 
     /* Reset "cave->mon_max" */
     c->mon_max = 1;
+    c->num_free = 0;
 
     /* Reset "mon_cnt" */
     c->mon_cnt = 0;
@@ -941,6 +867,24 @@ static s16b mon_pop(struct chunk *c)
 {
     int m_idx;
 
+    /* New monsters must be processed normally */
+    c->ready_ok = false;
+
+    /* Reuse the slot of a dead monster */
+    while (c->num_free)
+    {
+        m_idx = c->mon_free[--c->num_free];
+
+        /* Paranoia */
+        if ((m_idx >= cave_monster_max(c)) || cave_monster(c, m_idx)->race) continue;
+
+        /* Count monsters */
+        c->mon_cnt++;
+
+        /* Return the index */
+        return m_idx;
+    }
+
     /* Normal allocation */
     if (cave_monster_max(c) < z_info->level_monster_max)
     {
@@ -957,22 +901,6 @@ static s16b mon_pop(struct chunk *c)
         return m_idx;
     }
 
-    /* Recycle dead monsters if we've run out of room */
-    for (m_idx = 1; m_idx < cave_monster_max(c); m_idx++)
-    {
-        struct monster *mon = cave_monster(c, m_idx);
-
-        /* Skip live monsters */
-        if (!mon->race)
-        {
-            /* Count monsters */
-            c->mon_cnt++;
-
-            /* Use this monster */
-            return m_idx;
-        }
-    }
-
     /* Warn the player if no index is available */
     if (!ht_zero(&c->generated)) plog("Too many monsters!");
 
@@ -1367,7 +1295,11 @@ s16b place_monster(struct player *p, struct chunk *c, struct monster *mon, byte
     if (loading)
     {
         m_idx = mon->midx;
-        c->mon_max++;
+
+        /* Slots skipped in the savefile are free */
+        while (c->mon_max < m_idx) c->mon_free[c->num_free++] = c->mon_max++;
+
+        if (c->mon_max == m_idx) c->mon_max++;
         c->mon_cnt++;
     }
     else
@@ -1384,6 +1316,8 @@ s16b place_monster(struct player *p, struct chunk *c, struct monster *mon, byte
 
     /* Set the ID */
     new_mon->midx = m_idx;
+    new_mon->generation = ++monster_generation;
+    monster_census_invalidate(c);
 
     /* Set the location */
     square_set_mon(c, &mon->grid, new_mon->midx);
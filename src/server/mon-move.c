@@ -773,6 +773,15 @@ static bool get_move_find_safety(struct player *p, struct chunk *c, struct monst
             /* Skip locations in a wall */
             if (!square_ispassable(c, &grid)) continue;
 
+            /* Check for absence of shot (more or less) */
+            if (square_isview(p, &grid)) continue;
+
+            /* Calculate distance from player */
+            dis = distance(&grid, &p->grid);
+
+            /* Only check further grids than the best one so far */
+            if (dis <= gdis) continue;
+
             /* Ignore too-distant grids */
             if (p->cave->noise.grids[grid.y][grid.x] >
                 p->cave->noise.grids[mon->grid.y][mon->grid.x] + 2 * d)
@@ -783,19 +792,9 @@ static bool get_move_find_safety(struct player *p, struct chunk *c, struct monst
             /* Ignore damaging terrain if they can't handle it */
             if (monster_hates_grid(c, mon, &grid)) continue;
 
-            /* Check for absence of shot (more or less) */
-            if (!square_isview(p, &grid))
-            {
-                /* Calculate distance from player */
-                dis = distance(&grid, &p->grid);
-
-                /* Remember if further than previous */
-                if (dis > gdis)
-                {
-                    loc_copy(&best, &grid);
-                    gdis = dis;
-                }
-            }
+            /* Remember if further than previous */
+            loc_copy(&best, &grid);
+            gdis = dis;
         }
 
         /* Check for success */
@@ -855,19 +854,21 @@ static bool get_move_find_hiding(struct player *p, struct chunk *c, struct monst
             /* Skip occupied locations */
             if (!square_isemptyfloor(c, &grid)) continue;
 
-            /* Check for hidden, available grid */
-            if (!square_isview(p, &grid) && projectable(p, c, &mon->grid, &grid, PROJECT_STOP, true))
-            {
-                /* Calculate distance from player */
-                dis = distance(&grid, &p->grid);
+            /* Check for hidden grid */
+            if (square_isview(p, &grid)) continue;
 
-                /* Remember if closer than previous */
-                if ((dis < gdis) && (dis >= min))
-                {
-                    loc_copy(&best, &grid);
-                    gdis = dis;
-                }
-            }
+            /* Calculate distance from player */
+            dis = distance(&grid, &p->grid);
+
+            /* Only check closer grids than the best one so far (but not too close) */
+            if ((dis >= gdis) || (dis < min)) continue;
+
+            /* Check for available grid (the path is only traced for useful grids) */
+            if (!projectable(p, c, &mon->grid, &grid, PROJECT_STOP, true)) continue;
+
+            /* Remember if closer than previous */
+            loc_copy(&best, &grid);
+            gdis = dis;
         }
 
         /* Check for success */
@@ -1296,6 +1297,46 @@ static bool get_move(struct source *who, struct chunk *c, struct monster *mon, i
  */
 
 
+/*
+ * Check if the level can take one more clone.
+ *
+ * Past half of the maximum number of breeders, the chance to breed drops
+ * linearly down to zero. The number of clones born on a level in a given
+ * second is also limited to a quarter of the maximum, so that a breeder
+ * explosion is spread over time instead of happening in a few game turns.
+ */
+static bool breeding_allowed(struct chunk *c)
+{
+    int half = z_info->repro_monster_max / 2;
+
+    /* Limit number of clones */
+    if (c->num_repro >= z_info->repro_monster_max) return false;
+
+    /* Start a new breeding window */
+    if (ht_diff(&turn, &c->repro_turn) >= (u32b)cfg_fps)
+    {
+        ht_copy(&c->repro_turn, &turn);
+        c->repro_window = 0;
+    }
+
+    /* Limit number of clones born during the breeding window */
+    if (c->repro_window >= MAX(z_info->repro_monster_max / 4, 1))
+    {
+        c->repro_throttled++;
+        return false;
+    }
+
+    /* Multiply slower when the level gets crowded */
+    if ((c->num_repro > half) && (randint0(half) >= z_info->repro_monster_max - c->num_repro))
+    {
+        c->repro_throttled++;
+        return false;
+    }
+
+    return true;
+}
+
+
 /*
  * Lets the given monster attempt to reproduce.
  *
@@ -1305,9 +1346,12 @@ static bool get_move(struct source *who, struct chunk *c, struct monster *mon, i
  */
 bool multiply_monster(struct player *p, struct chunk *c, struct monster *mon)
 {
-    int i;
+    int n = 0, spots = 0, i;
     bool result = false;
     struct monster_group_info info = {0, 0};
+    struct loc grids[8];
+    struct loc begin, end;
+    struct loc_iterator iter;
 
     my_assert(mon);
 
@@ -1320,28 +1364,47 @@ bool multiply_monster(struct player *p, struct chunk *c, struct monster *mon)
     /* No uniques */
     if (monster_is_unique(mon->race)) return false;
 
-    /* Limit number of clones */
-    if (c->num_repro == z_info->repro_monster_max) return false;
+    /* Check the breeding throttle */
+    if (!breeding_allowed(c)) return false;
 
-    /* Try up to 18 times */
-    for (i = 0; i < 18; i++)
+    loc_init(&begin, mon->grid.x - 1, mon->grid.y - 1);
+    loc_init(&end, mon->grid.x + 1, mon->grid.y + 1);
+    loc_iterator_first(&iter, &begin, &end);
+
+    /* Collect the adjacent "empty" floor grids, counting the grids scatter() could pick */
+    do
     {
-        int d = 1;
-        struct loc grid;
+        if (!square_in_bounds_fully(c, &iter.cur)) continue;
+        spots++;
+        if (loc_eq(&iter.cur, &mon->grid)) continue;
+        if (!square_isemptyfloor(c, &iter.cur)) continue;
+        loc_copy(&grids[n++], &iter.cur);
+    }
+    while (loc_iterator_next(&iter));
 
-        /* Pick a location */
-        if (!scatter(c, &grid, &mon->grid, d, true)) continue;
+    /* No room */
+    if (!n) return false;
 
-        /* Require an "empty" floor grid */
-        if (!square_isemptyfloor(c, &grid)) continue;
+    /* Try up to 18 times, like 18 scatter() picks around the monster */
+    for (i = 0; i < 18; i++)
+    {
+        if (randint0(spots) >= n) continue;
 
         /* Create a new monster (awake, no groups) */
-        result = place_new_monster(p, c, &grid, mon->race, MON_CLONE, &info, ORIGIN_DROP_BREED);
+        result = place_new_monster(p, c, &grids[randint0(n)], mon->race, MON_CLONE, &info,
+            ORIGIN_DROP_BREED);
 
         /* Done */
         break;
     }
 
+    /* Update breeding statistics */
+    if (result)
+    {
+        c->repro_window++;
+        c->repro_births++;
+    }
+
     /* Result */
     return (result);
 }
@@ -2298,6 +2361,9 @@ static struct monster *get_closest_target(struct chunk *c, struct monster *mon,
         /* Compute distance */
         j = distance(&current_m_ptr->grid, &mon->grid);
 
+        /* A farther target can't beat a visible one (no need to check LOS) */
+        if (target_m_los && (j > target_m_dis)) continue;
+
         /* Check if monster has LOS to the target */
         new_los = los(c, &mon->grid, &current_m_ptr->grid);
 
@@ -2710,6 +2776,72 @@ static void get_closest_player(struct chunk *c, struct monster *mon)
 }
 
 
+/*
+ * Dormant monsters
+ *
+ * Passive monsters which are far from every player don't do anything on their turn: they
+ * don't regenerate (they are unhurt), and their sleep and timed effects don't decrease. Such
+ * monsters are marked as dormant and skipped entirely until they get hurt, a player appears
+ * suddenly on the level, or a periodic check finds a player close enough.
+ */
+#define DORMANT_HEARTBEAT   10
+
+
+/*
+ * Distance to the closest player beyond which a monster can go dormant
+ *
+ * Stay out of view and out of reach of the monster senses, allowing players to close in
+ * during a heartbeat (noise and scent flows are never shorter than 2/3 of the distance).
+ */
+static int dormant_range(struct monster *mon)
+{
+    int range = cfg_dormant_range;
+
+    range = MAX(range, z_info->max_sight + DORMANT_HEARTBEAT);
+    range = MAX(range, 3 * (mon->race->hearing + 10) / 2 + DORMANT_HEARTBEAT);
+    range = MAX(range, 3 * mon->race->smell / 2 + DORMANT_HEARTBEAT);
+
+    return range;
+}
+
+
+/*
+ * Check if a passive monster can go dormant
+ */
+static bool monster_can_go_dormant(struct chunk *c, struct monster *mon)
+{
+    /* Dormancy is disabled */
+    if (!cfg_dormant_range) return false;
+
+    /* Hurt or controlled monsters must be processed */
+    if ((mon->hp < mon->maxhp) || mon->master) return false;
+
+    /* Monster is taking damage from the terrain */
+    if (monster_taking_terrain_damage(c, mon)) return false;
+
+    return (mon->cdis > dormant_range(mon));
+}
+
+
+/*
+ * Check if a dormant monster stays dormant
+ */
+static bool monster_stays_dormant(struct chunk *c, struct monster *mon)
+{
+    /* Hurt or controlled monsters wake up */
+    if ((mon->hp < mon->maxhp) || mon->master) return false;
+
+    /* A player appeared somewhere on the level */
+    if (mon->dormant_stamp != c->dormant_stamp) return false;
+
+    /* A player came closer (distance is updated when players move) */
+    if (mon->cdis <= dormant_range(mon)) return false;
+
+    /* Check again every now and then */
+    return ((turn.turn + mon->midx) % DORMANT_HEARTBEAT)? true: false;
+}
+
+
 /*
  * Process all the "live" monsters, once per game turn.
  *
@@ -2723,13 +2855,33 @@ static void get_closest_player(struct chunk *c, struct monster *mon)
  */
 void process_monsters(struct chunk *c, bool more_energy)
 {
-    int i, j, time;
+    int i, j, n, num, time;
+    int max = cave_monster_max(c);
+    bool use_ready;
 
     /* Only process some things every so often */
     bool regen;
 
+    /*
+     * Monsters with even more energy than their closest player move before the players, the
+     * rest of the monsters move after. The first pass remembers the monsters which may still
+     * act this turn, so that the second pass doesn't need to scan the whole monster list again.
+     * Monsters without enough energy to move can't get any until the end of the turn, so they
+     * are done during the first pass.
+     */
+    if (more_energy)
+    {
+        if (!c->mon_ready) c->mon_ready = mem_zalloc(z_info->level_monster_max * sizeof(u16b));
+        c->num_ready = 0;
+        c->ready_ok = true;
+        use_ready = false;
+    }
+    else
+        use_ready = c->ready_ok;
+    num = (use_ready? c->num_ready: max - 1);
+
     /* Process the monsters (backwards) */
-    for (i = cave_monster_max(c) - 1; i >= 1; i--)
+    for (n = 0; n < num; n++)
     {
         struct monster *mon;
         int target_m_dis;
@@ -2737,6 +2889,8 @@ void process_monsters(struct chunk *c, bool more_energy)
         struct source who_body;
         struct source *who = &who_body;
 
+        i = (use_ready? c->mon_ready[n]: max - 1 - n);
+
         /* Get a 'live' monster */
         mon = cave_monster(c, i);
         if (!mon->race) continue;
@@ -2744,17 +2898,45 @@ void process_monsters(struct chunk *c, bool more_energy)
         /* Ignore monsters that have already been handled */
         if (mflag_has(mon->mflag, MFLAG_HANDLED)) continue;
 
+        /* Dormant monsters only use up their energy */
+        if (mon->dormant)
+        {
+            if (monster_stays_dormant(c, mon))
+            {
+                mflag_on(mon->mflag, MFLAG_HANDLED);
+                if (mon->energy >= move_energy(mon->wpos.depth))
+                    mon->energy -= move_energy(mon->wpos.depth);
+                continue;
+            }
+
+            /* Wake up */
+            mon->dormant = false;
+        }
+
         /* Skip "unconscious" monsters */
-        if (mon->hp == 0) continue;
+        if (mon->hp == 0)
+        {
+            if (more_energy) c->mon_ready[c->num_ready++] = i;
+            continue;
+        }
 
         /* Get closest player */
         get_closest_player(c, mon);
 
         /* Paranoia -- make sure we have a closest player */
-        if (!mon->closest_player) continue;
+        if (!mon->closest_player)
+        {
+            if (more_energy) c->mon_ready[c->num_ready++] = i;
+            continue;
+        }
 
         /* Not enough energy to move yet */
-        if (more_energy && (mon->energy <= mon->closest_player->energy)) continue;
+        if (more_energy && (mon->energy <= mon->closest_player->energy) &&
+            (mon->energy >= move_energy(mon->wpos.depth)))
+        {
+            c->mon_ready[c->num_ready++] = i;
+            continue;
+        }
 
         /* Prevent reprocessing */
         mflag_on(mon->mflag, MFLAG_HANDLED);
@@ -2790,24 +2972,13 @@ void process_monsters(struct chunk *c, bool more_energy)
         /* Hack -- controlled monsters need to "sense" their master */
         if (mon->master)
         {
-            /* Check everyone */
-            for (j = 1; j <= NumPlayers; j++)
-            {
-                struct player *q = player_get(j);
-                int d;
-
-                /* Find the master */
-                if (q->id != mon->master) continue;
-
-                /* Compute distance */
-                d = distance(&q->grid, &mon->grid);
-
-                /* Player is inside scanning range */
-                if (d <= mon->race->hearing) break;
-
-                /* The monster is visible */
-                if (monster_is_visible(q, mon->midx)) break;
+            /* Find the master */
+            struct player *q = player_find(mon->master);
 
+            /* Master is outside scanning range and can't see the monster */
+            if (q && (distance(&q->grid, &mon->grid) > mon->race->hearing) &&
+                !monster_is_visible(q, mon->midx))
+            {
                 /* Sometimes free monster from slavery */
                 if (one_in_(100))
                 {
@@ -2829,6 +3000,13 @@ void process_monsters(struct chunk *c, bool more_energy)
             /* The monster takes its turn */
             monster_turn(who, c, mon, target_m_dis);
         }
+
+        /* Passive monsters far from every player go dormant */
+        else if (monster_can_go_dormant(c, mon))
+        {
+            mon->dormant = true;
+            mon->dormant_stamp = c->dormant_stamp;
+        }
     }
 
     /* Efficiency */
@@ -2880,6 +3058,9 @@ void reset_monsters(struct chunk *c)
         /* Monster is ready to go again */
         mflag_off(mon->mflag, MFLAG_HANDLED);
     }
+
+    /* The list of monsters left to process is now obsolete */
+    c->ready_ok = false;
 }
 
 
@@ -28,6 +28,14 @@
 #define MAX_STORED_MON_CODES    400
 
 
+/*
+ * Stacked messages and history entries are chained in hash buckets, so that
+ * looking for a duplicate doesn't need to scan all the entries
+ */
+#define MON_MSG_HASH_SIZE       256
+#define MON_MSG_HASH(a, b, c)   ((((a) * 31 + (b)) * 7 + (c)) & (MON_MSG_HASH_SIZE - 1))
+
+
 /*
  * Flags for whether monsters are offscreen or invisible
  */
@@ -109,11 +117,15 @@ static bool redundant_monster_message(struct player *p, struct monster *mon, int
     my_assert(msg_code >= 0);
     my_assert(msg_code < MON_MSG_MAX);
 
-    for (i = 0; i < p->size_mon_hist; i++)
+    for (i = p->mon_hist_hash[MON_MSG_HASH(mon->midx, msg_code, 0)]; i;
+        i = p->mon_message_hist[i - 1].next)
     {
         /* Check for a matched monster & monster code */
-        if ((mon == p->mon_message_hist[i].mon) && (msg_code == p->mon_message_hist[i].message_code))
+        if ((mon == p->mon_message_hist[i - 1].mon) &&
+            (msg_code == p->mon_message_hist[i - 1].message_code))
+        {
             return true;
+        }
     }
 
     return false;
@@ -145,9 +157,13 @@ static void store_monster(struct player *p, struct monster *mon, int msg_code)
     /* Record which monster had this message stored */
     if (p->size_mon_hist < MAX_STORED_MON_CODES)
     {
+        int hash = MON_MSG_HASH(mon->midx, msg_code, 0);
+
         p->mon_message_hist[p->size_mon_hist].mon = mon;
         p->mon_message_hist[p->size_mon_hist].message_code = msg_code;
+        p->mon_message_hist[p->size_mon_hist].next = p->mon_hist_hash[hash];
         p->size_mon_hist++;
+        p->mon_hist_hash[hash] = p->size_mon_hist;
     }
 }
 
@@ -161,14 +177,15 @@ static bool stack_message(struct player *p, struct monster *mon, int msg_code, i
 {
     int i;
 
-    for (i = 0; i < p->size_mon_msg; i++)
+    for (i = p->mon_msg_hash[MON_MSG_HASH(mon->race->ridx, msg_code, flags)]; i;
+        i = p->mon_msg[i - 1].next)
     {
+        struct monster_race_message *msg = &p->mon_msg[i - 1];
+
         /* We found the race and the message code */
-        if ((p->mon_msg[i].race == mon->race) &&
-            (p->mon_msg[i].flags == flags) &&
-            (p->mon_msg[i].msg_code == msg_code))
+        if ((msg->race == mon->race) && (msg->flags == flags) && (msg->msg_code == msg_code))
         {
-            p->mon_msg[i].count++;
+            msg->count++;
             store_monster(p, mon, msg_code);
             return true;
         }
@@ -211,12 +228,16 @@ bool add_monster_message(struct player *p, struct monster *mon, int msg_code, bo
     /* If not possible, check we have storage space for more messages and add */
     if (p->size_mon_msg < MAX_STORED_MON_MSG)
     {
+        int hash = MON_MSG_HASH(mon->race->ridx, msg_code, flags);
+
         p->mon_msg[p->size_mon_msg].race = mon->race;
         p->mon_msg[p->size_mon_msg].flags = flags;
         p->mon_msg[p->size_mon_msg].msg_code = msg_code;
         p->mon_msg[p->size_mon_msg].count = 1;
         p->mon_msg[p->size_mon_msg].delay = what_delay(msg_code, delay);
+        p->mon_msg[p->size_mon_msg].next = p->mon_msg_hash[hash];
         p->size_mon_msg++;
+        p->mon_msg_hash[hash] = p->size_mon_msg;
 
         store_monster(p, mon, msg_code);
 
@@ -429,6 +450,10 @@ void show_monster_messages(struct player *p)
         }
     }
 
+    /* Empty the hash buckets (monsters may be gone, so don't rehash the entries) */
+    memset(p->mon_msg_hash, 0, MON_MSG_HASH_SIZE * sizeof(int));
+    memset(p->mon_hist_hash, 0, MON_MSG_HASH_SIZE * sizeof(int));
+
     /* Delete all the stacked messages and history */
     p->size_mon_msg = p->size_mon_hist = 0;
 }
@@ -477,6 +502,8 @@ void monmsg_init(struct player *p)
     /* Array of stacked monster messages */
     p->mon_msg = mem_zalloc(MAX_STORED_MON_MSG * sizeof(*p->mon_msg));
     p->mon_message_hist = mem_zalloc(MAX_STORED_MON_CODES * sizeof(*p->mon_message_hist));
+    p->mon_msg_hash = mem_zalloc(MON_MSG_HASH_SIZE * sizeof(int));
+    p->mon_hist_hash = mem_zalloc(MON_MSG_HASH_SIZE * sizeof(int));
 }
 
 
@@ -485,4 +512,6 @@ void monmsg_cleanup(struct player *p)
     /* Free the stacked monster messages */
     mem_free(p->mon_msg);
     mem_free(p->mon_message_hist);
+    mem_free(p->mon_msg_hash);
+    mem_free(p->mon_hist_hash);
 }
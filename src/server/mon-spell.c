@@ -243,6 +243,59 @@ static const struct mon_spell_info
 };
 
 
+/*
+ * Spell flags matching any of the spell types of each combination of spell type bitflags,
+ * built at init from the table above
+ */
+static bitflag spell_type_masks[RST_MAX][RSF_SIZE];
+
+
+static void init_spell_type_masks(void)
+{
+    const struct mon_spell_info *info;
+    int i, types;
+
+    memset(spell_type_masks, 0, sizeof(spell_type_masks));
+
+    /* Spells of each single type */
+    for (info = mon_spell_types; info->index < RSF_MAX; info++)
+    {
+        for (i = 0; (1 << i) < RST_MAX; i++)
+        {
+            if (info->type & (1 << i)) rsf_on(spell_type_masks[1 << i], info->index);
+        }
+    }
+
+    /* Combinations: lowest type plus the others */
+    for (types = 1; types < RST_MAX; types++)
+    {
+        int low = (types & -types);
+
+        if (low == types) continue;
+        rsf_copy(spell_type_masks[types], spell_type_masks[types - low]);
+        rsf_union(spell_type_masks[types], spell_type_masks[low]);
+    }
+}
+
+
+struct init_module mon_spell_module =
+{
+    "mon-spell",
+    init_spell_type_masks,
+    NULL
+};
+
+
+/*
+ * Build the set of spell flags matching any of the given spell types,
+ * so that spell sets can be filtered word-wise
+ */
+static void spell_type_mask(bitflag *f, int types)
+{
+    rsf_copy(f, spell_type_masks[types & (RST_MAX - 1)]);
+}
+
+
 /*
  * Check if a spell effect which has been saved against would also have
  * been prevented by an object property, and learn the appropriate rune
@@ -387,15 +440,10 @@ bool mon_spell_is_innate(int index)
  */
 bool test_spells(bitflag *f, int types)
 {
-    const struct mon_spell_info *info;
+    bitflag mask[RSF_SIZE];
 
-    for (info = mon_spell_types; info->index < RSF_MAX; info++)
-    {
-        if (rsf_has(f, info->index) && (info->type & types))
-            return true;
-    }
-
-    return false;
+    spell_type_mask(mask, types);
+    return rsf_is_inter(f, mask);
 }
 
 
@@ -404,13 +452,10 @@ bool test_spells(bitflag *f, int types)
  */
 void set_breath(bitflag *f)
 {
-    const struct mon_spell_info *info;
+    bitflag mask[RSF_SIZE];
 
-    for (info = mon_spell_types; info->index < RSF_MAX; info++)
-    {
-        if (rsf_has(f, info->index) && !(info->type & RST_BREATH))
-            rsf_off(f, info->index);
-    }
+    spell_type_mask(mask, RST_BREATH);
+    rsf_inter(f, mask);
 }
 
 
@@ -422,13 +467,10 @@ void set_breath(bitflag *f)
  */
 void ignore_spells(bitflag *f, int types)
 {
-    const struct mon_spell_info *info;
+    bitflag mask[RSF_SIZE];
 
-    for (info = mon_spell_types; info->index < RSF_MAX; info++)
-    {
-        if (rsf_has(f, info->index) && (info->type & types))
-            rsf_off(f, info->index);
-    }
+    spell_type_mask(mask, types);
+    rsf_diff(f, mask);
 }
 
 
@@ -603,25 +645,18 @@ static int mon_spell_dam(int index, int hp, const struct monster_race *race, asp
  */
 void create_mon_spell_mask(bitflag *f, ...)
 {
-    const struct mon_spell_info *rs;
-    int i;
+    int i, types = RST_NONE;
     va_list args;
 
-    rsf_wipe(f);
-
     va_start(args, f);
 
     /* Process each type in the va_args */
     for (i = va_arg(args, int); i != RST_NONE; i = va_arg(args, int))
-    {
-        for (rs = mon_spell_types; rs->index < RSF_MAX; rs++)
-        {
-            if (rs->type & i)
-                rsf_on(f, rs->index);
-        }
-    }
+        types |= i;
 
     va_end(args);
+
+    spell_type_mask(f, types);
 }
 
 
@@ -590,6 +590,9 @@ void monster_swap(struct chunk *c, struct loc *grid1, struct loc *grid2)
     m1 = square(c, &from)->mon;
     m2 = square(c, &to)->mon;
 
+    /* Players appearing out of nowhere wake dormant monsters */
+    if (((m1 < 0) || (m2 < 0)) && (distance(&from, &to) > 1)) c->dormant_stamp++;
+
     /* Update grids */
     square_set_mon(c, &from, m2);
     square_set_mon(c, &to, m1);
@@ -864,15 +867,15 @@ static struct monster *get_injured_kin(struct chunk *c, const struct monster *mo
     if (!kin) return NULL;
     if (kin->race->base != mon->race->base) return NULL;
 
-    /* Check line of sight */
-    if (!los(c, &((struct monster *)mon)->grid, grid)) return NULL;
-
     /* Check injury */
     if (kin->hp == kin->maxhp) return NULL;
 
     /* Check distance */
     if (distance(&((struct monster *)mon)->grid, grid) > MAX_KIN_DISTANCE) return NULL;
 
+    /* Check line of sight (last, since it's the expensive test) */
+    if (!los(c, &((struct monster *)mon)->grid, grid)) return NULL;
+
     return kin;
 }
 
@@ -884,15 +887,19 @@ static struct monster *get_injured_kin(struct chunk *c, const struct monster *mo
  */
 bool find_any_nearby_injured_kin(struct chunk *c, const struct monster *mon)
 {
-    struct loc grid;
+    struct loc begin, end;
+    struct actor_iterator iter;
 
-    for (grid.y = mon->grid.y - MAX_KIN_RADIUS; grid.y <= mon->grid.y + MAX_KIN_RADIUS; grid.y++)
+    loc_init(&begin, mon->grid.x - MAX_KIN_RADIUS, mon->grid.y - MAX_KIN_RADIUS);
+    loc_init(&end, mon->grid.x + MAX_KIN_RADIUS, mon->grid.y + MAX_KIN_RADIUS);
+
+    /* Only check grids holding a monster */
+    if (!actor_iterator_first(&iter, c, &begin, &end)) return false;
+    do
     {
-        for (grid.x = mon->grid.x - MAX_KIN_RADIUS; grid.x <= mon->grid.x + MAX_KIN_RADIUS; grid.x++)
-        {
-            if (get_injured_kin(c, mon, &grid) != NULL) return true;
-        }
+        if (get_injured_kin(c, mon, &iter.cur) != NULL) return true;
     }
+    while (actor_iterator_next(&iter, c));
 
     return false;
 }
@@ -907,17 +914,23 @@ bool find_any_nearby_injured_kin(struct chunk *c, const struct monster *mon)
 struct monster *choose_nearby_injured_kin(struct chunk *c, const struct monster *mon)
 {
     struct set *set = set_new();
-    struct loc grid;
+    struct loc begin, end;
+    struct actor_iterator iter;
     struct monster *found;
 
-    for (grid.y = mon->grid.y - MAX_KIN_RADIUS; grid.y <= mon->grid.y + MAX_KIN_RADIUS; grid.y++)
+    loc_init(&begin, mon->grid.x - MAX_KIN_RADIUS, mon->grid.y - MAX_KIN_RADIUS);
+    loc_init(&end, mon->grid.x + MAX_KIN_RADIUS, mon->grid.y + MAX_KIN_RADIUS);
+
+    /* Only check grids holding a monster */
+    if (actor_iterator_first(&iter, c, &begin, &end))
     {
-        for (grid.x = mon->grid.x - MAX_KIN_RADIUS; grid.x <= mon->grid.x + MAX_KIN_RADIUS; grid.x++)
+        do
         {
-            struct monster *kin = get_injured_kin(c, mon, &grid);
+            struct monster *kin = get_injured_kin(c, mon, &iter.cur);
 
             if (kin != NULL) set_add(set, kin);
         }
+        while (actor_iterator_next(&iter, c));
     }
 
     found = set_choose(set);
@@ -1937,6 +1950,7 @@ bool monster_change_shape(struct player *p, struct monster *mon)
     {
         if (!mon->original_race) mon->original_race = mon->race;
         mon->race = race;
+        monster_census_invalidate(c);
         mon->mspeed += mon->race->speed - mon->original_race->speed;
     }
 
@@ -1983,6 +1997,7 @@ bool monster_revert_shape(struct player *p, struct monster *mon)
         mon->mspeed += mon->original_race->speed - mon->race->speed;
         mon->race = mon->original_race;
         mon->original_race = NULL;
+        monster_census_invalidate(c);
 
         /* Emergency teleport if needed */
         if (!monster_passes_walls(mon->race) && square_iswall(c, &mon->grid))
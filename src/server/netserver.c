@@ -2489,26 +2489,10 @@ static void end_mind_link(struct player *p, struct player *p_ptr2)
 }
 
 
-static struct player *find_player(s32b id)
-{
-    int i;
-
-    for (i = 1; i <= NumPlayers; i++)
-    {
-        struct player *p = player_get(i);
-
-        if (p->id == id) return p;
-    }
-
-    /* Assume none */
-    return NULL;
-}
-
-
 static void break_mind_link(struct player *p)
 {
     if (p->esp_link && (p->esp_link_type == LINK_DOMINANT))
-        end_mind_link(p, find_player(p->esp_link));
+        end_mind_link(p, player_find(p->esp_link));
 }
 
 
@@ -2516,7 +2500,7 @@ static connection_t* get_mind_link(struct player *p)
 {
     if (p->esp_link && (p->esp_link_type == LINK_DOMINATED))
     {
-        struct player *p_ptr2 = find_player(p->esp_link);
+        struct player *p_ptr2 = player_find(p->esp_link);
 
         if (p_ptr2) return get_connection(p_ptr2->conn);
         end_mind_link(p, NULL);
@@ -2546,7 +2530,7 @@ int Send_line_info(struct player *p, int y)
     connp2 = get_mind_link(p);
     if (connp2)
     {
-        p_ptr2 = find_player(p->esp_link);
+        p_ptr2 = player_find(p->esp_link);
         screen_wid2 = p_ptr2->screen_cols / p_ptr2->tile_wid;
     }
 
@@ -2649,7 +2633,7 @@ int Send_char(struct player *p, struct loc *grid, u16b a, char c, u16b ta, char
     connp2 = get_mind_link(p);
     if (connp2 && (connp2->state == CONN_PLAYING))
     {
-        struct player *p_ptr2 = find_player(p->esp_link);
+        struct player *p_ptr2 = player_find(p->esp_link);
 
         if (p_ptr2->use_graphics && (p_ptr2->remote_term == NTERM_WIN_OVERHEAD))
         {
@@ -3323,6 +3307,45 @@ int Send_flush(struct player *p, bool fresh, bool delay)
 }
 
 
+static int Send_effect_aux(sockbuf_t *buf, const struct effect_op *ops, int num)
+{
+    int i, n;
+
+    if ((n = Packet_printf(buf, "%b%hd", (unsigned)PKT_EFFECT, num)) <= 0) return n;
+
+    for (i = 0; i < num; i++)
+    {
+        const struct effect_op *step = &ops[i];
+
+        if ((n = Packet_printf(buf, "%b", (unsigned)step->op)) <= 0) return n;
+
+        if (step->op == EFFECT_DRAW)
+        {
+            n = Packet_printf(buf, "%b%b%b%c", (unsigned)step->grid.x, (unsigned)step->grid.y,
+                (unsigned)step->a, (int)step->c);
+        }
+        else if (step->op == EFFECT_RESTORE)
+            n = Packet_printf(buf, "%b%b", (unsigned)step->grid.x, (unsigned)step->grid.y);
+        if (n <= 0) return n;
+    }
+
+    return 1;
+}
+
+
+int Send_effect(struct player *p, const struct effect_op *ops, int num)
+{
+    connection_t *connp2;
+    connection_t *connp = get_connp(p, "effect");
+    if (connp == NULL) return 0;
+
+    connp2 = get_mind_link(p);
+    if (connp2 && (connp2->state == CONN_PLAYING)) Send_effect_aux(&connp2->c, ops, num);
+
+    return Send_effect_aux(&connp->c, ops, num);
+}
+
+
 int Send_channel(struct player *p, byte n, const char *virt)
 {
     connection_t *connp = get_connp(p, "channel");
@@ -5617,6 +5640,7 @@ static int Receive_toggle_ignore(int ind)
         break_mind_link(p);
 
         p->unignoring = !p->unignoring;
+        player_knowledge_changed(p);
         p->upkeep->notice |= PN_IGNORE;
         do_cmd_redraw(p);
     }
@@ -6695,6 +6719,9 @@ static int Receive_options(int ind)
         for (i = 0; i < OPT_MAX; i++)
             p->opts.opt[i] = connp->options[i];
 
+        /* Object descriptions may show flavors */
+        player_knowledge_changed(p);
+
         /* Update birth options */
         update_birth_options(p, &options, true);
 
@@ -7356,6 +7383,9 @@ static int Receive_ignore(int ind)
             if (new_ignore_level[i] > p->opts.ignore_lvl[i]) ignore = true;
             p->opts.ignore_lvl[i] = new_ignore_level[i];
         }
+
+        /* Object descriptions may show "{ignore}" */
+        player_knowledge_changed(p);
     }
 
     /* Notice and redraw as needed */
@@ -7729,6 +7759,9 @@ int Net_output_p(struct player *p)
 {
     connection_t *connp = get_connection(p->conn);
 
+    /* Send the projection visuals of the turn */
+    effect_frame_send(p);
+
     /*
      * If we have any data to send to the client, terminate it
      * and send it to the client.
@@ -546,6 +546,126 @@ static size_t obj_desc_aware(struct player *p, const struct object *obj, char *b
 }
 
 
+/*
+ * Description cache
+ *
+ * Descriptions are remembered per player, object and mode. An entry is only used if the
+ * player's object knowledge hasn't changed since (see player_knowledge_changed()) and if
+ * everything object_desc() reads from the object and its known version is unchanged. Objects
+ * are modified directly in too many places to keep a mutation counter, so a checksum of those
+ * fields is used instead.
+ */
+#define DESC_CACHE_SIZE 1024
+
+struct desc_cache_entry
+{
+    s32b player_id;
+    const struct object *obj;
+    int mode;
+    u32b epoch;
+    u32b checksum;
+    size_t len;
+    char desc[NORMAL_WID];
+};
+
+static struct desc_cache_entry desc_cache[DESC_CACHE_SIZE];
+
+static u32b knowledge_epoch;
+
+
+/*
+ * Note that the object knowledge of a player has changed
+ */
+void player_knowledge_changed(struct player *p)
+{
+    if (!p) return;
+
+    /* Epochs are unique across players, so reused player ids never match old entries */
+    p->knowledge_epoch = ++knowledge_epoch;
+    if (!p->knowledge_epoch) p->knowledge_epoch = ++knowledge_epoch;
+
+    /* The known equipment bonuses may differ too */
+    forget_equip_bonuses(p);
+}
+
+
+static u32b desc_checksum_aux(u32b sum, const void *data, size_t len)
+{
+    const byte *bytes = (const byte *)data;
+    size_t i;
+
+    /* FNV-1a */
+    for (i = 0; i < len; i++)
+    {
+        sum ^= bytes[i];
+        sum *= 16777619;
+    }
+
+    return sum;
+}
+
+
+#define DESC_CHECKSUM(S, F) \
+    desc_checksum_aux((S), &(F), sizeof(F))
+
+
+static u32b desc_checksum(u32b sum, const struct object *obj)
+{
+    sum = DESC_CHECKSUM(sum, obj->kind);
+    sum = DESC_CHECKSUM(sum, obj->ego);
+    sum = DESC_CHECKSUM(sum, obj->artifact);
+    sum = DESC_CHECKSUM(sum, obj->tval);
+    sum = DESC_CHECKSUM(sum, obj->sval);
+    sum = DESC_CHECKSUM(sum, obj->pval);
+    sum = DESC_CHECKSUM(sum, obj->dd);
+    sum = DESC_CHECKSUM(sum, obj->ds);
+    sum = DESC_CHECKSUM(sum, obj->ac);
+    sum = DESC_CHECKSUM(sum, obj->to_a);
+    sum = DESC_CHECKSUM(sum, obj->to_h);
+    sum = DESC_CHECKSUM(sum, obj->to_d);
+    sum = DESC_CHECKSUM(sum, obj->flags);
+    sum = DESC_CHECKSUM(sum, obj->modifiers);
+    sum = DESC_CHECKSUM(sum, obj->el_info);
+    if (obj->brands) sum = desc_checksum_aux(sum, obj->brands, z_info->brand_max * sizeof(bool));
+    if (obj->slays) sum = desc_checksum_aux(sum, obj->slays, z_info->slay_max * sizeof(bool));
+    if (obj->curses)
+    {
+        sum = desc_checksum_aux(sum, obj->curses,
+            z_info->curse_max * sizeof(struct curse_data));
+    }
+    sum = DESC_CHECKSUM(sum, obj->effect);
+    sum = DESC_CHECKSUM(sum, obj->activation);
+    sum = DESC_CHECKSUM(sum, obj->time);
+    sum = DESC_CHECKSUM(sum, obj->timeout);
+    sum = DESC_CHECKSUM(sum, obj->number);
+    sum = DESC_CHECKSUM(sum, obj->notice);
+    sum = DESC_CHECKSUM(sum, obj->origin);
+    sum = DESC_CHECKSUM(sum, obj->note);
+    sum = DESC_CHECKSUM(sum, obj->ignore_protect);
+    sum = DESC_CHECKSUM(sum, obj->decay);
+    sum = DESC_CHECKSUM(sum, obj->bypass_aware);
+    sum = DESC_CHECKSUM(sum, obj->randart_seed);
+
+    return sum;
+}
+
+
+static struct desc_cache_entry *desc_cache_entry(struct player *p, const struct object *obj,
+    int mode)
+{
+    unsigned long key = (unsigned long)obj / sizeof(void *);
+
+    key ^= (unsigned long)p->id * 2654435761UL;
+    key ^= (unsigned long)mode * 40503UL;
+
+    return &desc_cache[key % DESC_CACHE_SIZE];
+}
+
+
+static size_t object_desc_aux(struct player *p, char *buf, size_t max,
+    const struct object *obj, int mode);
+
+
 /*
  * Describes item "obj" into buffer "buf" of size "max".
  *
@@ -560,6 +680,47 @@ static size_t obj_desc_aware(struct player *p, const struct object *obj, char *b
  * ODESC_SALE turns off unseen and ignore markers, for items purchased from floor
  */
 size_t object_desc(struct player *p, char *buf, size_t max, const struct object *obj, int mode)
+{
+    struct desc_cache_entry *entry;
+    u32b checksum;
+    size_t len;
+
+    /* Only cache real descriptions for a player */
+    if (!p || !obj || !obj->known || !max) return object_desc_aux(p, buf, max, obj, mode);
+
+    if (!p->knowledge_epoch) player_knowledge_changed(p);
+    checksum = desc_checksum(desc_checksum(2166136261UL, obj), obj->known);
+    entry = desc_cache_entry(p, obj, mode);
+
+    /* Reuse the description */
+    if ((entry->obj == obj) && (entry->player_id == p->id) && (entry->mode == mode) &&
+        (entry->epoch == p->knowledge_epoch) && (entry->checksum == checksum) &&
+        (entry->len < max))
+    {
+        memcpy(buf, entry->desc, entry->len + 1);
+        return entry->len;
+    }
+
+    len = object_desc_aux(p, buf, max, obj, mode);
+
+    /* Remember it (unless truncated) */
+    if ((len < sizeof(entry->desc)) && (len + 1 < max))
+    {
+        entry->obj = obj;
+        entry->player_id = p->id;
+        entry->mode = mode;
+        entry->epoch = p->knowledge_epoch;
+        entry->checksum = checksum;
+        entry->len = len;
+        memcpy(entry->desc, buf, len + 1);
+    }
+
+    return len;
+}
+
+
+static size_t object_desc_aux(struct player *p, char *buf, size_t max,
+    const struct object *obj, int mode)
 {
     bool prefix = ((mode & ODESC_PREFIX)? true: false);
     bool terse = ((mode & ODESC_TERSE)? true: false);
@@ -27,6 +27,7 @@ enum
     ODESC_FLAVOR    = 0x200     /* Show flavor */
 };
 
+extern void player_knowledge_changed(struct player *p);
 extern size_t object_desc(struct player *p, char *buf, size_t max, const struct object *obj,
     int mode);
 
@@ -547,6 +547,59 @@ static void get_known_elements(const struct object *obj, int mode, struct elemen
 }
 
 
+/*
+ * Last hypothetical player state, remembered while describing an object
+ */
+static struct
+{
+    struct player *p;
+    const struct object *obj;
+    int slot;
+    struct player_state state;
+} wield_memo;
+
+
+/*
+ * Calculate the player's hypothetical state with the given object wielded in the given slot
+ * (or with the current equipment if slot is -1).
+ *
+ * Blows, damage and heaviness all need the same state, so it is only calculated once per
+ * object description.
+ */
+static void calc_wield_state(struct player *p, const struct object *obj, int slot,
+    struct player_state *state)
+{
+    struct object *current = NULL;
+
+    if (slot == -1) obj = NULL;
+
+    if ((wield_memo.p == p) && (wield_memo.obj == obj) && (wield_memo.slot == slot))
+    {
+        memcpy(state, &wield_memo.state, sizeof(struct player_state));
+        return;
+    }
+
+    /* Pretend we're wielding the object */
+    if (slot != -1)
+    {
+        current = slot_object(p, slot);
+        p->body.slots[slot].obj = (struct object *)obj;
+    }
+
+    /* Calculate the player's hypothetical state */
+    memset(state, 0, sizeof(struct player_state));
+    calc_bonuses(p, state, true, false);
+
+    /* Stop pretending */
+    if (slot != -1) p->body.slots[slot].obj = current;
+
+    wield_memo.p = p;
+    wield_memo.obj = obj;
+    wield_memo.slot = slot;
+    memcpy(&wield_memo.state, state, sizeof(struct player_state));
+}
+
+
 /*
  * Gets information about the number of blows possible for the player with
  * the given object.
@@ -570,20 +623,14 @@ static int obj_known_blows(struct player *p, const struct object *obj, int max_n
     int dex_plus_bound;
     int str_plus_bound;
     struct player_state state;
-    int weapon_slot = slot_by_name(p, "weapon");
-    struct object *current_weapon = slot_object(p, weapon_slot);
     int num = 0;
     bool weapon = (tval_is_melee_weapon(obj) || tval_is_mstaff(obj));
 
     /* Not a weapon - no blows! */
     if (!weapon) return 0;
 
-    /* Pretend we're wielding the object */
-    p->body.slots[weapon_slot].obj = (struct object *)obj;
-
     /* Calculate the player's hypothetical state */
-    memset(&state, 0, sizeof(state));
-    calc_bonuses(p, &state, true, false);
+    calc_wield_state(p, obj, slot_by_name(p, "weapon"), &state);
 
     /* First entry is always the current num of blows. */
     possible_blows[num].str_plus = 0;
@@ -602,20 +649,12 @@ static int obj_known_blows(struct player *p, const struct object *obj, int max_n
         for (str_plus = 0; str_plus < str_plus_bound; str_plus++)
         {
             int new_blows;
-            struct player_state tmpstate;
 
             /* Unlikely */
-            if (num == max_num)
-            {
-                p->body.slots[weapon_slot].obj = current_weapon;
-                return num;
-            }
+            if (num == max_num) return num;
 
-            memset(&tmpstate, 0, sizeof(tmpstate));
-            tmpstate.stat_add[STAT_STR] = str_plus;
-            tmpstate.stat_add[STAT_DEX] = dex_plus;
-            calc_bonuses(p, &tmpstate, true, false);
-            new_blows = tmpstate.num_blows;
+            /* Only the blows change with extra STR and DEX */
+            new_blows = calc_blows_plus(p, obj, &state, str_plus, dex_plus);
 
             /* Test to make sure that this extra blow is a new str/dex combination, not a repeat */
             if (((new_blows - new_blows % 10) > (old_blows - old_blows % 10)) &&
@@ -648,9 +687,6 @@ static int obj_known_blows(struct player *p, const struct object *obj, int max_n
         }
     }
 
-    /* Stop pretending */
-    p->body.slots[weapon_slot].obj = current_weapon;
-
     return num;
 }
 
@@ -819,19 +855,10 @@ static bool obj_known_damage(struct player *p, const struct object *obj, int *no
     bool weapon = ((tval_is_melee_weapon(obj) || tval_is_mstaff(obj)) && !thrown);
     bool ammo = ((p->state.ammo_tval == obj->tval) && !thrown);
     struct player_state state;
-    int weapon_slot = slot_by_name(p, "weapon");
-    struct object *current_weapon = slot_object(p, weapon_slot);
     struct object *known_bow = (bow? bow->known: NULL);
 
-    /* Pretend we're wielding the object if it's a weapon */
-    if (weapon) p->body.slots[weapon_slot].obj = (struct object *)obj;
-
-    /* Calculate the player's hypothetical state */
-    memset(&state, 0, sizeof(state));
-    calc_bonuses(p, &state, true, false);
-
-    /* Stop pretending */
-    if (weapon) p->body.slots[weapon_slot].obj = current_weapon;
+    /* Calculate the player's hypothetical state, wielding the object if it's a weapon */
+    calc_wield_state(p, obj, (weapon? slot_by_name(p, "weapon"): -1), &state);
 
     /* Get the brands */
     total_brands = mem_zalloc(z_info->brand_max * sizeof(bool));
@@ -1186,18 +1213,9 @@ static void obj_known_misc_combat(struct player *p, const struct object *obj,
     if (weapon)
     {
         struct player_state state;
-        int weapon_slot = slot_by_name(p, "weapon");
-        struct object *current_weapon = slot_object(p, weapon_slot);
-
-        /* Pretend we're wielding the object */
-        p->body.slots[weapon_slot].obj = (struct object *)obj;
 
         /* Calculate the player's hypothetical state */
-        memset(&state, 0, sizeof(state));
-        calc_bonuses(p, &state, true, false);
-
-        /* Stop pretending */
-        p->body.slots[weapon_slot].obj = current_weapon;
+        calc_wield_state(p, obj, slot_by_name(p, "weapon"), &state);
 
         /* Warn about heavy weapons */
         *heavy = state.heavy_wield;
@@ -1289,8 +1307,6 @@ static bool obj_known_digging(struct player *p, const struct object *obj, int de
     struct player_state state;
     int i;
     int chances[DIGGING_MAX];
-    int slot;
-    struct object *current;
     bool equipped = object_is_equipped(p->body, obj);
     s32b modifiers[OBJ_MOD_MAX];
 
@@ -1306,20 +1322,8 @@ static bool obj_known_digging(struct player *p, const struct object *obj, int de
         return false;
     }
 
-    /* Pretend we're wielding the object, unless already equipped */
-    if (!equipped)
-    {
-        slot = wield_slot(p, obj);
-        current = slot_object(p, slot);
-        p->body.slots[slot].obj = (struct object *)obj;
-    }
-
-    /* Calculate the player's hypothetical state */
-    memset(&state, 0, sizeof(state));
-    calc_bonuses(p, &state, true, false);
-
-    /* Stop pretending */
-    if (!equipped) p->body.slots[slot].obj = current;
+    /* Calculate the player's hypothetical state, wielding the object unless already equipped */
+    calc_wield_state(p, obj, (equipped? -1: wield_slot(p, obj)), &state);
 
     calc_digging_chances(p, &state, chances);
 
@@ -1821,6 +1825,9 @@ static void object_info_out(struct player *p, const struct object *obj, int mode
     /* Hack -- "wearable" items other than weapons/ammo add slays/brands to melee attacks */
     bool fulldesc = (tval_has_variable_power(obj) && !tval_is_enchantable_weapon(obj));
 
+    /* Forget the hypothetical state of the last description */
+    wield_memo.p = NULL;
+
     /* Unaware objects get simple descriptions */
     if (object_marked_aware(p, obj))
     {
@@ -887,6 +887,7 @@ void object_sense(struct player *p, struct object *obj)
     loc_copy(&new_obj->grid, &obj->grid);
     memcpy(&new_obj->wpos, &obj->wpos, sizeof(struct worldpos));
     pile_insert_end(&square_p(p, &new_obj->grid)->obj, new_obj);
+    square_note_pile(p, &new_obj->grid);
 }
 
 
@@ -1194,6 +1195,7 @@ static void player_learn_rune(struct player *p, size_t i, bool message)
 
     /* Nothing learned */
     if (!learned) return;
+    player_knowledge_changed(p);
 
     /* Give a message */
     if (message) msgt(p, MSG_RUNE, "You have learned the rune of %s.", rune_name(i));
@@ -1914,6 +1916,8 @@ static void object_flavor_aware_aux(struct player *p, struct object *obj, bool s
 
     /* Fully aware of the effects */
     p->kind_aware[obj->kind->kidx] = true;
+    player_knowledge_changed(p);
+    p->upkeep->update |= (PU_BONUS);
     if (send) Send_aware(p, obj->kind->kidx);
     apply_autoinscription(p, obj);
 
@@ -1973,7 +1977,9 @@ void object_flavor_tried(struct player *p, struct object *obj)
     /* Paranoia: don't mark artifacts as tried */
     if (obj->artifact) return;
 
+    if (p->kind_tried[obj->kind->kidx]) return;
     p->kind_tried[obj->kind->kidx] = true;
+    player_knowledge_changed(p);
 }
 
 
@@ -139,89 +139,121 @@ static bool object_list_should_ignore_object(struct player *p, struct chunk *c,
 
 
 /*
- * Collect object information from the current cave.
+ * Collect the objects of a known pile into the object list.
+ *
+ * Objects only group with objects on the same grid (see OSTACK_LIST), so the list
+ * entries of a pile are keyed by grid and object kind: only the entries added for
+ * the current pile need to be searched, and only those of the same kind need a
+ * full object_similar() check.
+ *
+ * Returns false if the list is full.
  */
-void object_list_collect(struct player *p, object_list_t *list)
+static bool object_list_collect_pile(struct player *p, struct chunk *c, object_list_t *list,
+    struct loc *grid)
 {
-	int i;
-    struct chunk *c = chunk_get(&p->wpos);
-    struct loc begin, end;
-    struct loc_iterator iter;
-
-	if (!object_list_can_update(list)) return;
-
-    loc_init(&begin, 1, 1);
-    loc_init(&end, c->width, c->height);
-    loc_iterator_first(&iter, &begin, &end);
+    object_list_entry_t *entry;
+    int entry_index, first = list->distinct_entries;
+    int field;
+    bool los = false;
+    struct object *obj;
 
-	/* Scan each object in the dungeon. */
-    do
-    {
-        object_list_entry_t *entry;
-        int entry_index;
-        int field;
-        bool los = false;
-        struct object *obj;
+    obj = square_known_pile(p, c, grid);
 
-        obj = square_known_pile(p, c, &iter.cur);
+    /* Skip unfilled entries, unknown objects and monster-held objects */
+    if (!obj) return true;
 
-        /* Skip unfilled entries, unknown objects and monster-held objects */
-        if (!obj) continue;
+    /* Determine which section of the list the object entry is in */
+    los = (projectable(p, c, &p->grid, grid, PROJECT_NONE, true) || loc_eq(grid, &p->grid));
+    field = (los? OBJECT_LIST_SECTION_LOS: OBJECT_LIST_SECTION_NO_LOS);
 
-        /* Determine which section of the list the object entry is in */
-        los = (projectable(p, c, &p->grid, &iter.cur, PROJECT_NONE, true) ||
-            loc_eq(&iter.cur, &p->grid));
-        field = (los? OBJECT_LIST_SECTION_LOS: OBJECT_LIST_SECTION_NO_LOS);
+    for ( ; obj; obj = obj->next)
+    {
+        if (object_list_should_ignore_object(p, c, obj)) continue;
 
-        for ( ; obj; obj = obj->next)
+        /* Find a matching entry among those of the current pile */
+        entry = NULL;
+        if (!is_unknown(obj))
         {
-            if (object_list_should_ignore_object(p, c, obj)) continue;
-
-            /* Find or add a list entry. */
-            entry = NULL;
-            for (entry_index = 0; entry_index < (int)list->entries_size; entry_index++)
+            for (entry_index = first; entry_index < list->distinct_entries; entry_index++)
             {
-                int j;
-
-                /* We found an empty slot, so add this object here. */
-                if (list->entries[entry_index].object == NULL)
-                {
-                    list->entries[entry_index].object = obj;
-                    for (j = 0; j < OBJECT_LIST_SECTION_MAX; j++)
-                        list->entries[entry_index].count[j] = 0;
-                    list->entries[entry_index].dy = iter.cur.y - p->grid.y;
-                    list->entries[entry_index].dx = iter.cur.x - p->grid.x;
-                    list->entries[entry_index].player = p;
-                    entry = &list->entries[entry_index];
-                    break;
-                }
+                struct object *match = list->entries[entry_index].object;
 
-                /* Use a matching object if we find one. */
-                if (!is_unknown(obj) &&
-                    object_similar(p, obj, list->entries[entry_index].object, OSTACK_LIST))
+                if (match->kind != obj->kind) continue;
+                if (object_similar(p, obj, match, OSTACK_LIST))
                 {
                     /* We found a matching object and we'll use that. */
                     entry = &list->entries[entry_index];
                     break;
                 }
             }
+        }
+
+        /* Add a list entry */
+        if (entry == NULL)
+        {
+            if (list->distinct_entries >= (int)list->entries_size) return false;
+
+            entry = &list->entries[list->distinct_entries];
+            entry->object = obj;
+            memset(entry->count, 0, OBJECT_LIST_SECTION_MAX * sizeof(u16b));
+            entry->dy = grid->y - p->grid.y;
+            entry->dx = grid->x - p->grid.x;
+            entry->player = p;
+            list->distinct_entries++;
+        }
 
-            if (entry == NULL) return;
+        /* We only know the number of objects we've actually seen */
+        if (!is_unknown(obj))
+            entry->count[field] += obj->number;
+        else
+            entry->count[field] = 1;
+    }
 
-            /* We only know the number of objects we've actually seen */
-            if (!is_unknown(obj))
-                entry->count[field] += obj->number;
-            else
-                entry->count[field] = 1;
+    return true;
+}
+
+
+/*
+ * Collect object information from the current cave.
+ *
+ * Only the grids holding a known object pile are visited.
+ */
+void object_list_collect(struct player *p, object_list_t *list)
+{
+	int i;
+    struct chunk *c = chunk_get(&p->wpos);
+
+	if (!object_list_can_update(list)) return;
+
+    /* Hack -- DM has full knowledge: scan each grid of the dungeon */
+    if (p->dm_flags & DM_SEE_LEVEL)
+    {
+        struct loc begin, end;
+        struct loc_iterator iter;
+
+        loc_init(&begin, 1, 1);
+        loc_init(&end, c->width, c->height);
+        loc_iterator_first(&iter, &begin, &end);
+
+        do
+        {
+            if (!object_list_collect_pile(p, c, list, &iter.cur)) break;
         }
+        while (loc_iterator_next_strict(&iter));
     }
-    while (loc_iterator_next_strict(&iter));
 
-	/* Collect totals for easier calculations of the list. */
-	for (i = 0; i < (int)list->entries_size; i++)
+    /* Scan each known object pile */
+    else
     {
-		if (list->entries[i].object == NULL) continue;
+        for (i = 0; i < p->cave->num_piles; i++)
+        {
+            if (!object_list_collect_pile(p, c, list, &p->cave->piles[i])) break;
+        }
+    }
 
+	/* Collect totals for easier calculations of the list. */
+	for (i = 0; i < list->distinct_entries; i++)
+    {
 		if (list->entries[i].count[OBJECT_LIST_SECTION_LOS] > 0)
 			list->total_entries[OBJECT_LIST_SECTION_LOS]++;
 
@@ -232,7 +264,6 @@ void object_list_collect(struct player *p, object_list_t *list)
             list->entries[i].count[OBJECT_LIST_SECTION_LOS];
 		list->total_objects[OBJECT_LIST_SECTION_NO_LOS] +=
             list->entries[i].count[OBJECT_LIST_SECTION_NO_LOS];
-		list->distinct_entries++;
 	}
 
 	list->sorted = false;
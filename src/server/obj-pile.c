@@ -848,6 +848,7 @@ struct object *floor_object_for_use(struct player *p, struct chunk *c, struct ob
     if (obj->number > num)
     {
         usable = object_split(obj, num);
+        house_stock_changed(&c->wpos, &grid);
 
         /* Describe if necessary */
         if (message) object_desc(p, name, sizeof(name), obj, ODESC_PREFIX | ODESC_FULL);
@@ -1005,6 +1006,7 @@ bool floor_carry(struct player *p, struct chunk *c, struct loc *grid, struct obj
         {
             /* Combine the items */
             object_absorb(obj, drop);
+            house_stock_changed(&c->wpos, grid);
 
             /* Note the pile */
             if (p && square_isview(p, grid)) square_note_spot(c, grid);
@@ -1043,6 +1045,7 @@ bool floor_carry(struct player *p, struct chunk *c, struct loc *grid, struct obj
 
     /* Link to the first object in the pile */
     pile_insert(&square(c, grid)->obj, drop);
+    house_stock_changed(&c->wpos, grid);
 
     /* Redraw */
     square_note_spot(c, grid);
@@ -1080,6 +1083,7 @@ bool floor_add(struct chunk *c, struct loc *grid, struct object *drop)
 
     /* Link to the last object in the pile */
     pile_insert_end(&square(c, grid)->obj, drop);
+    house_stock_changed(&c->wpos, grid);
 
     /* Result */
     return true;
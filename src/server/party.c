@@ -101,19 +101,9 @@ bool is_party_owner(struct player *p, struct player *q)
  */
 bool master_in_party(s16b p1_id, s16b p2_id)
 {
-    struct player *p1_ptr = NULL;
-    struct player *p2_ptr = NULL;
-    int i;
-
     /* Find IDs */
-    for (i = 1; i <= NumPlayers; i++)
-    {
-        struct player *p = player_get(i);
-
-        /* Check this one */
-        if (p1_id == p->id) p1_ptr = p;
-        if (p2_id == p->id) p2_ptr = p;
-    }
+    struct player *p1_ptr = player_find(p1_id);
+    struct player *p2_ptr = player_find(p2_id);
 
     /* Player IDs not found */
     if (!p1_ptr || !p2_ptr) return false;
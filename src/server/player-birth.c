@@ -1074,6 +1074,9 @@ static void player_setup(struct player *p, int id, u32b account, bool no_recall)
     /* Hack -- give 2 turns of invulnerability */
     p->timed[TMD_SAFELOGIN] = 2;
 
+    /* Track the active timed effects and spell cooldowns */
+    player_timed_track_all(p);
+
     /* Update and redraw stuff (all of these are probably not needed...) */
 
     /* Update stuff */
@@ -1796,14 +1796,14 @@ void calc_inventory(struct player *p)
  * Calculate the blows a player would get.
  *
  * obj is the object for which we are calculating blows
- * state is the player state for which we are calculating blows
+ * str_ind and dex_ind are the stat indexes for which we are calculating blows
  * extra_blows is the number of +blows available from this object and this state
  *
  * Note: state->num_blows is now 100x the number of blows
  *
  * PWMAngband: extra_blows is now 10x the number of extra blows to allow +0.1bpr per level for monks
  */
-static int calc_blows(struct player *p, const struct object *obj, struct player_state *state,
+static int calc_blows(struct player *p, const struct object *obj, int str_ind, int dex_ind,
     int extra_blows)
 {
     int blows = 100;
@@ -1820,13 +1820,13 @@ static int calc_blows(struct player *p, const struct object *obj, struct player_
         div = ((weight < min_weight)? min_weight: weight);
 
         /* Get the strength vs weight */
-        str_index = (adj_str_blow[state->stat_ind[STAT_STR]] * p->clazz->att_multiply / div);
+        str_index = (adj_str_blow[str_ind] * p->clazz->att_multiply / div);
 
         /* Maximal value */
         if (str_index > 11) str_index = 11;
 
         /* Index by dexterity */
-        dex_index = MIN(adj_dex_blow[state->stat_ind[STAT_DEX]], 11);
+        dex_index = MIN(adj_dex_blow[dex_ind], 11);
 
         /* Use the blows table to get energy per blow */
         blow_energy = blows_table[str_index][dex_index];
@@ -1839,6 +1839,60 @@ static int calc_blows(struct player *p, const struct object *obj, struct player_
 }
 
 
+/*
+ * Convert a stat value into an index into the stat tables
+ */
+static int stat_index(int use)
+{
+    /* Values: n/a */
+    if (use <= 3) return 0;
+
+    /* Values: 3, 4, ..., 17 */
+    if (use <= 18) return (use - 3);
+
+    /* Ranges: 18/00-18/09, ..., 18/210-18/219 */
+    if (use <= 18+219) return (15 + (use - 18) / 10);
+
+    /* Range: 18/220+ */
+    return 37;
+}
+
+
+/*
+ * Compute the index into the stat tables of a stat raised by "plus" points
+ */
+static int stat_index_plus(struct player *p, struct player_state *state, int stat, int plus)
+{
+    int add = state->stat_add[stat] + plus;
+
+    /* Polymorphed players only get half adjustment from race */
+    add += race_modifier(p->race, stat, p->lev, p->poly_race? true: false);
+    add += class_modifier(p->clazz, stat, p->lev);
+
+    return stat_index(modify_stat_value(p->stat_cur[stat], add));
+}
+
+
+/*
+ * Calculate the blows a player would get with STR and DEX raised by the given amounts.
+ *
+ * state is the player state computed by calc_bonuses() with weapon wielded; this gives the
+ * same result as another calc_bonuses() pass with str_plus and dex_plus added to stat_add[]
+ * without redoing the whole calculation.
+ */
+int calc_blows_plus(struct player *p, const struct object *weapon, struct player_state *state,
+    int str_plus, int dex_plus)
+{
+    int str_ind = stat_index_plus(p, state, STAT_STR, str_plus);
+    int dex_ind = stat_index_plus(p, state, STAT_DEX, dex_plus);
+
+    /* It is hard to hold a heavy weapon */
+    if (weapon && (adj_str_hold[str_ind] < weapon->weight / 10)) return 100;
+
+    return calc_blows(p, weapon, str_ind, dex_ind, state->extra_blows);
+}
+
+
 /*
  * Computes current weight limit.
  */
@@ -1949,90 +2003,47 @@ static bool object_modifier_is_known(const struct object *obj, int mod, bool awa
 
 
 /*
- * Calculate the players current "state", taking into account
- * not only race/class intrinsics, but also objects being worn
- * and temporary spell effects.
- *
- * See also calc_mana() and calc_hitpoints().
+ * Bonuses from the equipment
  *
- * Take note of the new "speed code", in particular, a very strong
- * player will start slowing down as soon as he reaches 150 pounds,
- * but not until he reaches 450 pounds will he be half as fast as
- * a normal kobold.  This both hurts and helps the player, hurts
- * because in the old days a player could just avoid 300 pounds,
- * and helps because now carrying 300 pounds is not very painful.
- *
- * The "weapon" and "bow" do *not* add to the bonuses to hit or to
- * damage, since that would affect non-combat things.  These values
- * are actually added in later, at the appropriate place.
- *
- * If known_only is true, calc_bonuses() will only use the known
- * information of objects; thus it returns what the player _knows_
- * the character state to be.
+ * These only depend on the equipment and on what the player knows about it, so they are kept
+ * between calls to update_bonuses() and only calculated again when PU_BONUS is set.
  */
-void calc_bonuses(struct player *p, struct player_state *state, bool known_only, bool update)
+struct equip_bonuses
 {
-    int i, j, hold;
-    int extra_blows = 0;
-    int extra_shots = 0;
-    int extra_might = 0;
-    int extra_moves = 0;
-    struct object *launcher = equipped_item_by_slot_name(p, "shooting");
-    struct object *weapon = equipped_item_by_slot_name(p, "weapon");
-    bitflag f[OF_SIZE], f2[OF_SIZE];
-    bitflag collect_f[OF_SIZE];
+    bool valid;
+    int stat_add[STAT_MAX];
+    int skills[SKILL_MAX];
+    int see_infra;
+    int speed;
+    int dam_red;
+    int extra_blows;
+    int extra_shots;
+    int extra_might;
+    int extra_moves;
+    int res_level[ELEM_MAX];
     bool vuln[ELEM_MAX];
-    bool unencumbered_monk = monk_armor_ok(p);
-    bool restrict_ = (player_has(p, PF_MARTIAL_ARTS) && !unencumbered_monk);
-    byte cumber_shield = 0;
-    struct element_info el_info[ELEM_MAX];
-    struct object *tool = equipped_item_by_slot_name(p, "tool");
-    int eq_to_a = 0;
-
-    create_obj_flag_mask(f2, 0, OFT_ESP, OFT_MAX);
-
-    /* Set various defaults */
-    state->speed = 110;
-    state->num_blows = 100;
-
-    /* Extract race/class info */
-    for (i = 0; i < SKILL_MAX; i++)
-        state->skills[i] = p->race->r_skills[i] + p->clazz->c_skills[i];
-    player_elements(p, el_info);
-    for (i = 0; i < ELEM_MAX; i++)
-    {
-        vuln[i] = false;
-        if (el_info[i].res_level == -1)
-            vuln[i] = true;
-        else
-            state->el_info[i].res_level = el_info[i].res_level;
-    }
-    pf_wipe(state->pflags);
-    pf_copy(state->pflags, p->race->pflags);
-    pf_union(state->pflags, p->clazz->pflags);
-
-    /* Extract the player flags */
-    player_flags(p, collect_f);
-
-    /* Ghost */
-    if (p->ghost) state->see_infra += 3;
+    bitflag flags[OF_SIZE];
+    byte cumber_shield;
+    int ac;
+    int to_a;
+    int to_h;
+    int to_d;
+};
 
-    /* Handle polymorphed players */
-    if (p->poly_race)
-    {
-        state->to_d += getAvgDam(p->poly_race);
 
-        /* Fruit bat mode: get regular speed bonus */
-        if (OPT(p, birth_fruit_bat)) state->speed += (p->poly_race->speed - 110);
-
-        /* At low level, we get MOVES instead */
-        else if (p->lev < 20) extra_moves = (p->poly_race->speed - 110) / 2;
+/*
+ * Analyze equipment
+ */
+static void calc_equip_bonuses(struct player *p, struct equip_bonuses *eq, bool known_only)
+{
+    int i, j;
+    bitflag f[OF_SIZE];
+    struct element_info el_info[ELEM_MAX];
+    bool unencumbered_monk = monk_armor_ok(p);
 
-        /* At higher level, we get 50% of speed bonus */
-        else state->speed += (p->poly_race->speed - 110) / 2;
-    }
+    memset(eq, 0, sizeof(struct equip_bonuses));
+    eq->valid = true;
 
-    /* Analyze equipment */
     for (i = 0; i < p->body.count; i++)
     {
         int dig = 0;
@@ -2051,7 +2062,7 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
         else
             object_flags(obj, f);
 
-        of_union(collect_f, f);
+        of_union(eq->flags, f);
 
         object_modifiers(obj, modifiers);
         object_elements(obj, el_info);
@@ -2063,20 +2074,20 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
         }
 
         /* Affect stats */
-        state->stat_add[STAT_STR] += modifiers[OBJ_MOD_STR];
-        state->stat_add[STAT_INT] += modifiers[OBJ_MOD_INT];
-        state->stat_add[STAT_WIS] += modifiers[OBJ_MOD_WIS];
-        state->stat_add[STAT_DEX] += modifiers[OBJ_MOD_DEX];
-        state->stat_add[STAT_CON] += modifiers[OBJ_MOD_CON];
+        eq->stat_add[STAT_STR] += modifiers[OBJ_MOD_STR];
+        eq->stat_add[STAT_INT] += modifiers[OBJ_MOD_INT];
+        eq->stat_add[STAT_WIS] += modifiers[OBJ_MOD_WIS];
+        eq->stat_add[STAT_DEX] += modifiers[OBJ_MOD_DEX];
+        eq->stat_add[STAT_CON] += modifiers[OBJ_MOD_CON];
 
         /* Affect stealth */
-        state->skills[SKILL_STEALTH] += modifiers[OBJ_MOD_STEALTH];
+        eq->skills[SKILL_STEALTH] += modifiers[OBJ_MOD_STEALTH];
 
         /* Affect searching ability (factor of five) */
-        state->skills[SKILL_SEARCH] += (modifiers[OBJ_MOD_SEARCH] * 5);
+        eq->skills[SKILL_SEARCH] += (modifiers[OBJ_MOD_SEARCH] * 5);
 
         /* Affect infravision */
-        state->see_infra += modifiers[OBJ_MOD_INFRA];
+        eq->see_infra += modifiers[OBJ_MOD_INFRA];
 
         /* Affect digging (innate effect, plus bonus, times 20) */
         if (tval_is_digger(obj))
@@ -2086,25 +2097,25 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
             else if (of_has(obj->flags, OF_DIG_3)) dig = 3;
         }
         dig += modifiers[OBJ_MOD_TUNNEL];
-        state->skills[SKILL_DIGGING] += (dig * 20);
+        eq->skills[SKILL_DIGGING] += (dig * 20);
 
         /* Affect speed */
-        state->speed += modifiers[OBJ_MOD_SPEED];
+        eq->speed += modifiers[OBJ_MOD_SPEED];
 
         /* Affect damage reduction */
-        state->dam_red += modifiers[OBJ_MOD_DAM_RED];
+        eq->dam_red += modifiers[OBJ_MOD_DAM_RED];
 
         /* Affect blows */
-        extra_blows += (modifiers[OBJ_MOD_BLOWS] * 10);
+        eq->extra_blows += (modifiers[OBJ_MOD_BLOWS] * 10);
 
         /* Affect shots */
-        extra_shots += modifiers[OBJ_MOD_SHOTS];
+        eq->extra_shots += modifiers[OBJ_MOD_SHOTS];
 
         /* Affect Might */
-        extra_might += modifiers[OBJ_MOD_MIGHT];
+        eq->extra_might += modifiers[OBJ_MOD_MIGHT];
 
         /* Affect movement speed */
-        extra_moves += modifiers[OBJ_MOD_MOVES];
+        eq->extra_moves += modifiers[OBJ_MOD_MOVES];
 
         /* Affect resists */
         for (j = 0; j < ELEM_MAX; j++)
@@ -2113,20 +2124,20 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
             {
                 /* Note vulnerability for later processing */
                 if (el_info[j].res_level == -1)
-                    vuln[j] = true;
+                    eq->vuln[j] = true;
 
                 /* OK because res_level has not included vulnerability yet */
-                if (el_info[j].res_level > state->el_info[j].res_level)
-                    state->el_info[j].res_level = el_info[j].res_level;
+                if (el_info[j].res_level > eq->res_level[j])
+                    eq->res_level[j] = el_info[j].res_level;
             }
         }
 
         /* Shield encumberance */
-        if (kf_has(obj->kind->kind_flags, KF_TWO_HANDED)) cumber_shield++;
-        if (slot_type_is(p, i, EQUIP_SHIELD) && cumber_shield) cumber_shield++;
+        if (kf_has(obj->kind->kind_flags, KF_TWO_HANDED)) eq->cumber_shield++;
+        if (slot_type_is(p, i, EQUIP_SHIELD) && eq->cumber_shield) eq->cumber_shield++;
 
         /* Modify the base armor class */
-        state->ac += obj->ac;
+        eq->ac += obj->ac;
 
         /* Apply the bonuses to armor class */
         if (!known_only || object_is_known(p, obj) || obj->known->to_a)
@@ -2134,7 +2145,7 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
             s16b to_a;
 
             object_to_a(obj, &to_a);
-            eq_to_a += to_a;
+            eq->to_a += to_a;
         }
 
         /* Do not apply weapon and bow bonuses until combat calculations */
@@ -2149,18 +2160,129 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
             object_to_h(obj, &to_h);
             object_to_d(obj, &to_d);
 
-            state->to_h += to_h;
-            state->to_d += to_d;
+            eq->to_h += to_h;
+            eq->to_d += to_d;
 
             /* Unencumbered monks get double bonuses from gloves (if positive) */
             if (unencumbered_monk && slot_type_is(p, i, EQUIP_GLOVES))
             {
-                if (to_h > 0) state->to_h += to_h;
-                if (to_d > 0) state->to_d += to_d;
+                if (to_h > 0) eq->to_h += to_h;
+                if (to_d > 0) eq->to_d += to_d;
             }
         }
     }
 
+}
+
+
+/*
+ * Calculate the players current "state", taking into account
+ * not only race/class intrinsics, but also objects being worn
+ * and temporary spell effects.
+ *
+ * See also calc_mana() and calc_hitpoints().
+ *
+ * Take note of the new "speed code", in particular, a very strong
+ * player will start slowing down as soon as he reaches 150 pounds,
+ * but not until he reaches 450 pounds will he be half as fast as
+ * a normal kobold.  This both hurts and helps the player, hurts
+ * because in the old days a player could just avoid 300 pounds,
+ * and helps because now carrying 300 pounds is not very painful.
+ *
+ * The "weapon" and "bow" do *not* add to the bonuses to hit or to
+ * damage, since that would affect non-combat things.  These values
+ * are actually added in later, at the appropriate place.
+ *
+ * If known_only is true, calc_bonuses() will only use the known
+ * information of objects; thus it returns what the player _knows_
+ * the character state to be.
+ */
+static void calc_bonuses_aux(struct player *p, struct player_state *state, bool known_only,
+    bool update, const struct equip_bonuses *eq)
+{
+    int i, j, hold;
+    int extra_blows = 0;
+    int extra_shots = 0;
+    int extra_might = 0;
+    int extra_moves = 0;
+    struct object *launcher = equipped_item_by_slot_name(p, "shooting");
+    struct object *weapon = equipped_item_by_slot_name(p, "weapon");
+    bitflag f2[OF_SIZE];
+    bitflag collect_f[OF_SIZE];
+    bool vuln[ELEM_MAX];
+    bool unencumbered_monk = monk_armor_ok(p);
+    bool restrict_ = (player_has(p, PF_MARTIAL_ARTS) && !unencumbered_monk);
+    byte cumber_shield = 0;
+    struct element_info el_info[ELEM_MAX];
+    struct object *tool = equipped_item_by_slot_name(p, "tool");
+    int eq_to_a = 0;
+
+    create_obj_flag_mask(f2, 0, OFT_ESP, OFT_MAX);
+
+    /* Set various defaults */
+    state->speed = 110;
+    state->num_blows = 100;
+
+    /* Extract race/class info */
+    for (i = 0; i < SKILL_MAX; i++)
+        state->skills[i] = p->race->r_skills[i] + p->clazz->c_skills[i];
+    player_elements(p, el_info);
+    for (i = 0; i < ELEM_MAX; i++)
+    {
+        vuln[i] = false;
+        if (el_info[i].res_level == -1)
+            vuln[i] = true;
+        else
+            state->el_info[i].res_level = el_info[i].res_level;
+    }
+    pf_wipe(state->pflags);
+    pf_copy(state->pflags, p->race->pflags);
+    pf_union(state->pflags, p->clazz->pflags);
+
+    /* Extract the player flags */
+    player_flags(p, collect_f);
+
+    /* Ghost */
+    if (p->ghost) state->see_infra += 3;
+
+    /* Handle polymorphed players */
+    if (p->poly_race)
+    {
+        state->to_d += getAvgDam(p->poly_race);
+
+        /* Fruit bat mode: get regular speed bonus */
+        if (OPT(p, birth_fruit_bat)) state->speed += (p->poly_race->speed - 110);
+
+        /* At low level, we get MOVES instead */
+        else if (p->lev < 20) extra_moves = (p->poly_race->speed - 110) / 2;
+
+        /* At higher level, we get 50% of speed bonus */
+        else state->speed += (p->poly_race->speed - 110) / 2;
+    }
+
+    /* Apply the equipment bonuses */
+    for (i = 0; i < STAT_MAX; i++) state->stat_add[i] += eq->stat_add[i];
+    for (i = 0; i < SKILL_MAX; i++) state->skills[i] += eq->skills[i];
+    state->see_infra += eq->see_infra;
+    state->speed += eq->speed;
+    state->dam_red += eq->dam_red;
+    extra_blows += eq->extra_blows;
+    extra_shots += eq->extra_shots;
+    extra_might += eq->extra_might;
+    extra_moves += eq->extra_moves;
+    for (i = 0; i < ELEM_MAX; i++)
+    {
+        if (eq->vuln[i]) vuln[i] = true;
+        if (eq->res_level[i] > state->el_info[i].res_level)
+            state->el_info[i].res_level = eq->res_level[i];
+    }
+    of_union(collect_f, eq->flags);
+    cumber_shield = eq->cumber_shield;
+    state->ac += eq->ac;
+    eq_to_a = eq->to_a;
+    state->to_h += eq->to_h;
+    state->to_d += eq->to_d;
+
     /* Handle polymorphed players */
     if (p->poly_race && (p->poly_race->ac > eq_to_a))
     {
@@ -2229,19 +2351,7 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
         use = modify_stat_value(p->stat_cur[i], add);
 
         state->stat_use[i] = use;
-
-        /* Values: n/a */
-        if (use <= 3) ind = 0;
-
-        /* Values: 3, 4, ..., 17 */
-        else if (use <= 18) ind = (use - 3);
-
-        /* Ranges: 18/00-18/09, ..., 18/210-18/219 */
-        else if (use <= 18+219) ind = (15 + (use - 18) / 10);
-
-        /* Range: 18/220+ */
-        else ind = (37);
-
+        ind = stat_index(use);
         my_assert((0 <= ind) && (ind < STAT_RANGE));
 
         /* Save the new index */
@@ -2632,6 +2742,7 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
         state->see_infra += p->lev / 4;
 
     /* Analyze weapon */
+    state->extra_blows = extra_blows;
     state->heavy_wield = false;
     state->bless_wield = false;
     if (weapon)
@@ -2646,7 +2757,8 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
         /* Normal weapons */
         if (!state->heavy_wield)
         {
-            state->num_blows = calc_blows(p, weapon, state, extra_blows);
+            state->num_blows = calc_blows(p, weapon, state->stat_ind[STAT_STR],
+                state->stat_ind[STAT_DEX], extra_blows);
             if (!tool || !tval_is_digger(tool))
                 state->skills[SKILL_DIGGING] += (weapon->weight / 10);
         }
@@ -2662,7 +2774,8 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
     else
     {
         /* Unarmed */
-        state->num_blows = calc_blows(p, NULL, state, extra_blows);
+        state->num_blows = calc_blows(p, NULL, state->stat_ind[STAT_STR],
+            state->stat_ind[STAT_DEX], extra_blows);
     }
 
     /* Unencumbered monks get a bonus tohit/todam */
@@ -2704,6 +2817,60 @@ void calc_bonuses(struct player *p, struct player_state *state, bool known_only,
 }
 
 
+void calc_bonuses(struct player *p, struct player_state *state, bool known_only, bool update)
+{
+    struct equip_bonuses eq;
+
+    calc_equip_bonuses(p, &eq, known_only);
+    calc_bonuses_aux(p, state, known_only, update, &eq);
+}
+
+
+/*
+ * Forget the equipment bonuses kept for a player, when his equipment or what he knows about it
+ * has changed
+ */
+void forget_equip_bonuses(struct player *p)
+{
+    if (!p->upkeep || !p->upkeep->equip_bonuses) return;
+
+    p->upkeep->equip_bonuses[0].valid = false;
+    p->upkeep->equip_bonuses[1].valid = false;
+}
+
+
+/*
+ * Get the equipment bonuses of a player, calculating them again if needed
+ */
+static const struct equip_bonuses *get_equip_bonuses(struct player *p, bool known_only)
+{
+    struct equip_bonuses *eq;
+
+    if (!p->upkeep->equip_bonuses)
+        p->upkeep->equip_bonuses = mem_zalloc(2 * sizeof(struct equip_bonuses));
+    eq = &p->upkeep->equip_bonuses[known_only? 1: 0];
+
+    if (!eq->valid) calc_equip_bonuses(p, eq, known_only);
+
+#ifdef DEBUG_MODE
+    /* Check that the kept bonuses match the equipment */
+    else
+    {
+        struct equip_bonuses check;
+
+        calc_equip_bonuses(p, &check, known_only);
+        if (memcmp(eq, &check, sizeof(struct equip_bonuses)))
+        {
+            plog_fmt("Stale equipment bonuses for %s", p->name);
+            memcpy(eq, &check, sizeof(struct equip_bonuses));
+        }
+    }
+#endif
+
+    return eq;
+}
+
+
 /*
  * Calculate bonuses, and print various things on changes
  */
@@ -2729,8 +2896,8 @@ static void update_bonuses(struct player *p)
 
     memset(&state, 0, sizeof(state));
     memset(&known_state, 0, sizeof(known_state));
-    calc_bonuses(p, &state, false, true);
-    calc_bonuses(p, &known_state, true, true);
+    calc_bonuses_aux(p, &state, false, true, get_equip_bonuses(p, false));
+    calc_bonuses_aux(p, &known_state, true, true, get_equip_bonuses(p, true));
 
     /*
      * Notice changes
@@ -3051,9 +3218,12 @@ void update_stuff(struct player *p, struct chunk *c)
         calc_inventory(p);
     }
 
-    if (p->upkeep->update & PU_BONUS)
+    if (p->upkeep->update & (PU_BONUS | PU_TIMED))
     {
-        p->upkeep->update &= ~(PU_BONUS);
+        /* Only PU_BONUS may change the equipment bonuses */
+        if (p->upkeep->update & PU_BONUS) forget_equip_bonuses(p);
+
+        p->upkeep->update &= ~(PU_BONUS | PU_TIMED);
         update_bonuses(p);
     }
 
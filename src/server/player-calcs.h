@@ -26,6 +26,7 @@
 #define PU_MONSTERS     0x00000080L /* Update monsters */
 #define PU_DISTANCE     0x00000100L /* Update distances */
 #define PU_INVEN        0x00000200L /* Update inventory */
+#define PU_TIMED        0x00000400L /* Calculate bonuses (not from equipment) */
 
 extern const int adj_str_td[STAT_RANGE];
 extern const int adj_dex_th[STAT_RANGE];
@@ -39,8 +40,11 @@ extern bool obj_can_browse(struct player *p, const struct object *obj);
 extern bool earlier_object(struct player *p, struct object *orig, struct object *newobj,
     bool store);
 extern void calc_inventory(struct player *p);
+extern int calc_blows_plus(struct player *p, const struct object *weapon,
+    struct player_state *state, int str_plus, int dex_plus);
 extern int weight_limit(struct player_state *state);
 extern int weight_remaining(struct player *p);
+extern void forget_equip_bonuses(struct player *p);
 extern void calc_bonuses(struct player *p, struct player_state *state, bool known_only, bool update);
 extern void calc_digging_chances(struct player *p, struct player_state *state,
     int chances[DIGGING_MAX]);
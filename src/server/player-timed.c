@@ -326,6 +326,16 @@ struct file_parser player_timed_parser =
  */
 
 
+/*
+ * Set the value of a timed effect, keeping track of active effects
+ */
+static void player_timed_use(struct player *p, int idx, int v)
+{
+    p->timed[idx] = v;
+    if (v) player_timed_track(p, idx);
+}
+
+
 /*
  * Swap stats at random to temporarily scramble the player's stats.
  */
@@ -494,7 +504,7 @@ static bool set_bow_brand(struct player *p, int v)
     }
 
     /* Use the value */
-    p->timed[TMD_BOWBRAND] = v;
+    player_timed_use(p, TMD_BOWBRAND, v);
 
     /* Nothing to notice */
     if (!notice) return false;
@@ -513,6 +523,17 @@ static bool set_bow_brand(struct player *p, int v)
 }
 
 
+/*
+ * Timed effects don't change the bonuses from the equipment
+ */
+static u32b timed_update_flags(u32b flags)
+{
+    if (flags & PU_BONUS) flags = ((flags & ~(PU_BONUS)) | PU_TIMED);
+
+    return flags;
+}
+
+
 /*
  * Set a timed event permanently.
  */
@@ -545,7 +566,7 @@ static bool player_set_timed_perma(struct player *p, int idx)
     }
 
     /* Use the value */
-    p->timed[idx] = -1;
+    player_timed_use(p, idx, -1);
 
     /* Nothing to notice */
     if (!notify) return false;
@@ -557,7 +578,7 @@ static bool player_set_timed_perma(struct player *p, int idx)
     if (p->k_idx) aware_player(p, p);
 
     /* Update the visuals, as appropriate. */
-    p->upkeep->update |= effect->flag_update;
+    p->upkeep->update |= timed_update_flags(effect->flag_update);
     p->upkeep->redraw |= effect->flag_redraw;
 
     /* Handle stuff */
@@ -720,13 +741,13 @@ static bool set_adrenaline(struct player *p, int v)
     }
 
     /* Use the value */
-    p->timed[TMD_ADRENALINE] = v;
+    player_timed_use(p, TMD_ADRENALINE, v);
 
     /* Nothing to notice */
     if (!notice) return false;
 
     /* Notice */
-    p->upkeep->update |= (PU_BONUS);
+    p->upkeep->update |= (PU_TIMED);
 
     /* Disturb */
     disturb(p, 0);
@@ -796,13 +817,13 @@ static bool set_biofeedback(struct player *p, int v)
     }
 
     /* Use the value */
-    p->timed[TMD_BIOFEEDBACK] = v;
+    player_timed_use(p, TMD_BIOFEEDBACK, v);
 
     /* Nothing to notice */
     if (!notice) return false;
 
     /* Notice */
-    p->upkeep->update |= (PU_BONUS);
+    p->upkeep->update |= (PU_TIMED);
 
     /* Disturb */
     disturb(p, 0);
@@ -952,13 +973,13 @@ static bool set_harmony(struct player *p, int v)
     }
 
     /* Use the value */
-    p->timed[TMD_HARMONY] = v;
+    player_timed_use(p, TMD_HARMONY, v);
 
     /* Nothing to notice */
     if (!notice) return false;
 
     /* Notice */
-    p->upkeep->update |= (PU_BONUS);
+    p->upkeep->update |= (PU_TIMED);
 
     /* Disturb */
     disturb(p, 0);
@@ -991,6 +1012,72 @@ bool player_timed_grade_eq(struct player *p, int idx, char *match)
 }
 
 
+/*
+ * Find the range of values covered by the named grade of a timed effect
+ */
+bool player_timed_grade_range(int idx, const char *match, int *min, int *max)
+{
+    struct timed_grade *grade = timed_effects[idx].grade;
+    int low = 1;
+
+    while (grade)
+    {
+        if (grade->name && streq(grade->name, match))
+        {
+            *min = low;
+            *max = grade->max;
+            return true;
+        }
+        low = grade->max + 1;
+        grade = grade->next;
+    }
+
+    return false;
+}
+
+
+/*
+ * Add a timed effect to the sorted list of effects decreased over time
+ *
+ * Entries are removed by decrease_timeouts() once the effect has expired.
+ */
+void player_timed_track(struct player *p, int idx)
+{
+    int i, j;
+
+    for (i = 0; i < p->num_timed; i++)
+    {
+        if (p->timed_list[i] == idx) return;
+        if (p->timed_list[i] > idx) break;
+    }
+
+    for (j = p->num_timed; j > i; j--) p->timed_list[j] = p->timed_list[j - 1];
+    p->timed_list[i] = idx;
+    p->num_timed++;
+}
+
+
+/*
+ * Rebuild the list of active timed effects and the count of spells on cooldown
+ */
+void player_timed_track_all(struct player *p)
+{
+    int i;
+
+    p->num_timed = 0;
+    for (i = 0; i < TMD_MAX; i++)
+    {
+        if (p->timed[i]) p->timed_list[p->num_timed++] = i;
+    }
+
+    p->num_cooldowns = 0;
+    for (i = 0; i < p->clazz->magic.total_spells; i++)
+    {
+        if (p->spell_cooldown[i]) p->num_cooldowns++;
+    }
+}
+
+
 /*
  * Setting, increasing, decreasing and clearing timed effects
  */
@@ -1146,8 +1233,11 @@ bool player_set_timed(struct player *p, int idx, int v, bool notify)
     /* Hack -- food meter */
     if (idx == TMD_FOOD) food_meter = p->timed[idx] / 100;
 
+    /* Raising a space-time anchor */
+    if ((idx == TMD_ANCHOR) && !p->timed[idx]) register_st_anchor(p);
+
     /* Use the value */
-    p->timed[idx] = v;
+    player_timed_use(p, idx, v);
 
     /* Hack -- food meter */
     if ((idx == TMD_FOOD) && (food_meter != p->timed[idx] / 100))
@@ -1168,7 +1258,7 @@ bool player_set_timed(struct player *p, int idx, int v, bool notify)
         if (p->k_idx) aware_player(p, p);
 
         /* Update the visuals, as appropriate. */
-        p->upkeep->update |= effect->flag_update;
+        p->upkeep->update |= timed_update_flags(effect->flag_update);
         p->upkeep->redraw |= effect->flag_redraw;
 
         /* Handle stuff */
@@ -60,5 +60,8 @@ extern bool player_inc_timed(struct player *p, int idx, int v, bool notify, bool
 extern bool player_dec_timed(struct player *p, int idx, int v, bool notify);
 extern bool player_clear_timed(struct player *p, int idx, bool notify);
 extern bool player_timed_grade_eq(struct player *p, int idx, char *match);
+extern bool player_timed_grade_range(int idx, const char *match, int *min, int *max);
+extern void player_timed_track(struct player *p, int idx);
+extern void player_timed_track_all(struct player *p);
 
 #endif /* PLAYER_TIMED_H */
@@ -1361,22 +1361,58 @@ void current_clear(struct player *p)
 #define ANCHOR_RADIUS   12
 
 
-bool check_st_anchor(struct worldpos *wpos, struct loc *grid)
+/*
+ * Add a player with an active space-time anchor to the list of anchors of his level.
+ *
+ * Entries are never removed here: check_st_anchor() purges those of players who have left
+ * the level, logged out or lost the anchor.
+ */
+void register_st_anchor(struct player *p)
 {
+    struct chunk *c = chunk_get(&p->wpos);
     int i;
 
-    for (i = 1; i <= NumPlayers; i++)
+    /* Level not generated yet, the player will be registered when placed */
+    if (!c) return;
+
+    /* Already registered */
+    for (i = 0; i < c->num_anchors; i++)
     {
-        struct player *q = player_get(i);
+        if (c->anchors[i] == p->id) return;
+    }
+
+    if (c->num_anchors == c->max_anchors)
+    {
+        c->max_anchors = (c->max_anchors? 2 * c->max_anchors: 4);
+        c->anchors = mem_realloc(c->anchors, c->max_anchors * sizeof(s32b));
+    }
+    c->anchors[c->num_anchors++] = p->id;
+}
 
-        /* Skip players not on this level */
-        if (!wpos_eq(&q->wpos, wpos)) continue;
+
+bool check_st_anchor(struct worldpos *wpos, struct loc *grid)
+{
+    struct chunk *c = chunk_get(wpos);
+    int i = 0;
+
+    if (!c) return false;
+
+    /* Only players who raised an anchor on this level are listed */
+    while (i < c->num_anchors)
+    {
+        struct player *q = player_find(c->anchors[i]);
+
+        /* Purge players who left, moved away or lost the anchor */
+        if (!q || !wpos_eq(&q->wpos, wpos) || !q->timed[TMD_ANCHOR])
+        {
+            c->anchors[i] = c->anchors[--c->num_anchors];
+            continue;
+        }
+        i++;
 
         /* Skip players too far */
         if (distance(&q->grid, grid) > ANCHOR_RADIUS) continue;
 
-        if (!q->timed[TMD_ANCHOR]) continue;
-
         return true;
     }
 
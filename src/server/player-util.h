@@ -100,6 +100,7 @@ extern bool hp_player(struct player *p, int num);
 extern int get_player_num(struct player *p);
 extern void redraw_picture(struct player *p, int old_num);
 extern void current_clear(struct player *p);
+extern void register_st_anchor(struct player *p);
 extern bool check_st_anchor(struct worldpos *wpos, struct loc *grid);
 extern struct dragon_breed *get_dragon_form(struct monster_race *race);
 extern void poly_dragon(struct player *p, bool msg);
@@ -402,6 +402,18 @@ int NumPlayers;
 static struct player **Players;
 
 
+/*
+ * Cache of player indexes by player ID
+ *
+ * IDs are allocated sequentially, so two connected players almost never share a slot. A cached
+ * index is always checked against the player array, so it can't become invalid when players
+ * leave and indexes are swapped.
+ */
+#define PLAYER_ID_CACHE 1024
+
+static int player_id_cache[PLAYER_ID_CACHE];
+
+
 void init_players(void)
 {
     Players = mem_zalloc(MAX_PLAYERS * sizeof(struct player*));
@@ -426,6 +438,38 @@ void player_set(int id, struct player *p)
 }
 
 
+/*
+ * Find a connected player by ID
+ */
+struct player *player_find(s32b id)
+{
+    int slot = (int)(id & (PLAYER_ID_CACHE - 1));
+    int i = player_id_cache[slot];
+    struct player *p;
+
+    /* Try the cached index first */
+    if ((i > 0) && (i <= NumPlayers))
+    {
+        p = player_get(i);
+        if (p && (p->id == id)) return p;
+    }
+
+    for (i = 1; i <= NumPlayers; i++)
+    {
+        p = player_get(i);
+
+        if (p->id == id)
+        {
+            player_id_cache[slot] = i;
+            return p;
+        }
+    }
+
+    /* Assume none */
+    return NULL;
+}
+
+
 /*
  * Record the original (pre-ghost) cause of death
  */
@@ -531,6 +575,7 @@ void init_player(struct player *p, int conn, bool old_history, bool no_recall)
     p->upkeep->inven = mem_zalloc((z_info->pack_size + 1) * sizeof(struct object *));
     p->upkeep->quiver = mem_zalloc(z_info->quiver_size * sizeof(struct object *));
     p->timed = mem_zalloc(TMD_MAX * sizeof(s16b));
+    p->timed_list = mem_zalloc(TMD_MAX * sizeof(s16b));
     p->obj_k = object_new();
     p->obj_k->brands = mem_zalloc(z_info->brand_max * sizeof(bool));
     p->obj_k->slays = mem_zalloc(z_info->slay_max * sizeof(bool));
@@ -665,10 +710,12 @@ void cleanup_player(struct player *p)
     /* Free the things that are always initialised */
     if (p->obj_k) object_free(p->obj_k);
     mem_free(p->timed);
+    mem_free(p->timed_list);
     if (p->upkeep)
     {
         mem_free(p->upkeep->inven);
         mem_free(p->upkeep->quiver);
+        mem_free(p->upkeep->equip_bonuses);
     }
     mem_free(p->upkeep);
     p->upkeep = NULL;
@@ -689,6 +736,7 @@ void cleanup_player(struct player *p)
     }
     mem_free(p->scr_info);
     mem_free(p->trn_info);
+    effect_frame_free(p);
     for (i = 0; i < N_HISTORY_FLAGS; i++)
         mem_free(p->hist_flags[i]);
     for (i = 0; p->lore && (i < z_info->r_max); i++)
@@ -751,6 +799,12 @@ void player_cave_free(struct player *p)
 
     if (!p->cave->allocated) return;
 
+    /* Drop the known pile list (the piles themselves are wiped below) */
+    mem_free(p->cave->piles);
+    p->cave->piles = NULL;
+    p->cave->num_piles = 0;
+    p->cave->max_piles = 0;
+
     for (grid.y = 0; grid.y < p->cave->height; grid.y++)
     {
         for (grid.x = 0; grid.x < p->cave->width; grid.x++)
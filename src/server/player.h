@@ -107,6 +107,7 @@ extern void init_players(void);
 extern void free_players(void);
 extern struct player *player_get(int id);
 extern void player_set(int id, struct player *p);
+extern struct player *player_find(s32b id);
 extern void player_death_info(struct player *p, const char *died_from);
 extern void player_safe_name(char *safe, size_t safelen, const char *name);
 extern void init_player(struct player *p, int conn, bool old_history, bool no_recall);
@@ -366,6 +366,99 @@ int project_path(struct player *p, struct loc *gp, int range, struct chunk *c, s
 }
 
 
+/*
+ * Memo of projectable() results for a chunk.
+ *
+ * The same pairs of grids are checked repeatedly during a game turn (monster
+ * visibility, spell targeting, closest target...), so results which only
+ * depend on the terrain are remembered until the next game turn or until the
+ * terrain changes. Entries are tagged with a stamp: bumping the stamp of the
+ * memo forgets all entries at once.
+ */
+#define LOS_MEMO_SIZE   1024
+
+struct los_memo_entry
+{
+    struct loc grid1;
+    struct loc grid2;
+    int range;
+    int flg;
+    bool nowall;
+    bool result;
+    u32b stamp;
+};
+
+struct los_memo
+{
+    struct los_memo_entry entries[LOS_MEMO_SIZE];
+    hturn turn;         /* Game turn of the entries */
+    u32b stamp;         /* Current stamp */
+    u32b hits;          /* Number of memorized results used */
+    u32b misses;        /* Number of results computed */
+};
+
+
+/*
+ * Forget all memorized projection paths (the terrain has changed)
+ */
+void los_memo_reset(struct chunk *c)
+{
+    if (c->los_memo) c->los_memo->stamp++;
+}
+
+
+/*
+ * Free the projection memo of a chunk
+ */
+void los_memo_free(struct chunk *c)
+{
+    if (!c->los_memo) return;
+
+#ifdef DEBUG_MODE
+    if (c->los_memo->hits + c->los_memo->misses)
+    {
+        plog_fmt("Projection memo (%d,%d,%d): %lu hits, %lu misses", c->wpos.grid.x,
+            c->wpos.grid.y, c->wpos.depth, (unsigned long)c->los_memo->hits,
+            (unsigned long)c->los_memo->misses);
+    }
+#endif
+
+    mem_free(c->los_memo);
+    c->los_memo = NULL;
+}
+
+
+/*
+ * Get the memo entry for a projection path
+ */
+static struct los_memo_entry *los_memo_entry(struct chunk *c, struct loc *grid1,
+    struct loc *grid2, int range, int flg, bool nowall)
+{
+    struct los_memo *memo;
+    u32b hash;
+
+    if (!c->los_memo)
+    {
+        c->los_memo = mem_zalloc(sizeof(struct los_memo));
+        c->los_memo->stamp = 1;
+    }
+    memo = c->los_memo;
+
+    /* Forget the entries of previous turns */
+    if (ht_cmp(&memo->turn, &turn))
+    {
+        ht_copy(&memo->turn, &turn);
+        memo->stamp++;
+    }
+
+    hash = (u32b)grid1->y * 73856093U ^ (u32b)grid1->x * 19349663U ^
+        (u32b)grid2->y * 83492791U ^ (u32b)grid2->x * 2654435761U ^ (u32b)range * 40503U ^
+        (u32b)flg ^ (nowall? 0x10000: 0);
+
+    return &memo->entries[hash & (LOS_MEMO_SIZE - 1)];
+}
+
+
 /*
  * Determine if a bolt spell cast from grid1 to grid2 will arrive
  * at the final destination, assuming that no monster gets in the way,
@@ -385,24 +478,55 @@ bool projectable(struct player *p, struct chunk *c, struct loc *grid1, struct lo
     struct loc grid_g[512];
     int grid_n = 0;
     int max_range = z_info->max_range;
+    struct los_memo_entry *entry = NULL;
+    bool result = true;
 
     /* Check for shortened projection range */
     if ((flg & PROJECT_SHORT) && p && p->timed[TMD_COVERTRACKS]) max_range /= 4;
 
+    /* Only the path of the projection matters */
+    flg &= (PROJECT_THRU | PROJECT_STOP | PROJECT_INFO | PROJECT_ROCK);
+
+    /* Paths which don't depend on monsters or player memory can be memorized */
+    if (!(flg & (PROJECT_STOP | PROJECT_INFO)))
+    {
+        entry = los_memo_entry(c, grid1, grid2, max_range, flg, nowall);
+
+        if ((entry->stamp == c->los_memo->stamp) && loc_eq(&entry->grid1, grid1) &&
+            loc_eq(&entry->grid2, grid2) && (entry->range == max_range) && (entry->flg == flg) &&
+            (entry->nowall == nowall))
+        {
+            c->los_memo->hits++;
+            return entry->result;
+        }
+    }
+
     /* Check the projection path */
     grid_n = project_path(NULL, grid_g, max_range, c, grid1, grid2, flg);
 
     /* No grid is ever projectable from itself */
-    if (!grid_n) return false;
+    if (!grid_n) result = false;
 
     /* May not end in a wall grid */
-    if (nowall && !square_ispassable(c, &grid_g[grid_n - 1])) return false;
+    else if (nowall && !square_ispassable(c, &grid_g[grid_n - 1])) result = false;
 
     /* May not end in an unrequested grid */
-    if (!loc_eq(&grid_g[grid_n - 1], grid2)) return false;
+    else if (!loc_eq(&grid_g[grid_n - 1], grid2)) result = false;
+
+    /* Memorize the result */
+    if (entry)
+    {
+        loc_copy(&entry->grid1, grid1);
+        loc_copy(&entry->grid2, grid2);
+        entry->range = max_range;
+        entry->flg = flg;
+        entry->nowall = nowall;
+        entry->result = result;
+        entry->stamp = c->los_memo->stamp;
+        c->los_memo->misses++;
+    }
 
-    /* Assume okay */
-    return true;
+    return result;
 }
 
 
@@ -506,6 +630,256 @@ void origin_get_loc(struct loc *ploc, struct source *origin)
 }
 
 
+/*
+ * Scratch buffers used by project()
+ *
+ * project() can be called from within itself (for example when a monster killed by a
+ * ball explodes), so one workspace is kept for each level of nesting. The buffers only
+ * ever grow, so projections don't allocate memory once the workspaces are warm.
+ */
+struct project_workspace
+{
+    /* Actual grids in the "path" */
+    struct loc *path_grid;
+    int path_size;
+
+    /* Coordinates of the affected grids, and distance to each of them */
+    struct loc *blast_grid;
+    int *distance_to_grid;
+
+    /* Same, sorted by distance from the centre */
+    struct loc *sorted_grid;
+    int *sorted_distance;
+    int blast_size;
+
+    /* Number of affected grids at each distance */
+    int *dist_count;
+
+    /* Precalculated damage values for each distance */
+    int *dam_at_dist;
+    int dist_size;
+
+    /* Parameters used to calculate the damage values */
+    bool dam_cached;
+    int dam;
+    int rad;
+    bool dam_const;
+    byte diameter_of_source;
+};
+
+
+static struct project_workspace **workspaces;
+static int num_workspaces;
+static int project_depth;
+
+
+/*
+ * Get the workspace for a new projection
+ */
+static struct project_workspace *project_workspace_acquire(void)
+{
+    /* Add a workspace for this level of nesting */
+    if (project_depth == num_workspaces)
+    {
+        workspaces = mem_realloc(workspaces, (num_workspaces + 1) * sizeof(*workspaces));
+        workspaces[num_workspaces] = mem_zalloc(sizeof(struct project_workspace));
+        num_workspaces++;
+    }
+
+    return workspaces[project_depth++];
+}
+
+
+/*
+ * Release the workspace of the current projection
+ */
+static void project_workspace_release(void)
+{
+    project_depth--;
+}
+
+
+/*
+ * Make sure the workspace can hold a path of the given range and a blast of the given
+ * radius
+ */
+static void project_workspace_reserve(struct project_workspace *ws, int range, int rad)
+{
+    int dist_size = MAX(range, rad) + 1;
+
+    if (ws->path_size < range + 1)
+    {
+        ws->path_size = range + 1;
+        ws->path_grid = mem_realloc(ws->path_grid, ws->path_size * sizeof(struct loc));
+    }
+
+    if (ws->dist_size < dist_size)
+    {
+        ws->dist_size = dist_size;
+        ws->dist_count = mem_realloc(ws->dist_count, ws->dist_size * sizeof(int));
+        ws->dam_at_dist = mem_realloc(ws->dam_at_dist, ws->dist_size * sizeof(int));
+        ws->dam_cached = false;
+    }
+}
+
+
+/*
+ * Add a grid to the blast area of a projection
+ */
+static void project_add_grid(struct project_workspace *ws, int *num_grids, struct chunk *cv,
+    struct loc *grid, int dist)
+{
+    /* Extend the blast area */
+    if (*num_grids == ws->blast_size)
+    {
+        ws->blast_size = (ws->blast_size? ws->blast_size * 2: 256);
+        ws->blast_grid = mem_realloc(ws->blast_grid, ws->blast_size * sizeof(struct loc));
+        ws->distance_to_grid = mem_realloc(ws->distance_to_grid, ws->blast_size * sizeof(int));
+        ws->sorted_grid = mem_realloc(ws->sorted_grid, ws->blast_size * sizeof(struct loc));
+        ws->sorted_distance = mem_realloc(ws->sorted_distance, ws->blast_size * sizeof(int));
+    }
+
+    loc_copy(&ws->blast_grid[*num_grids], grid);
+    ws->distance_to_grid[*num_grids] = dist;
+    sqinfo_on(square(cv, grid)->info, SQUARE_PROJECT);
+    (*num_grids)++;
+}
+
+
+/*
+ * Calculate and store the actual damage at each distance.
+ *
+ * The values only depend on the damage, radius and source diameter, so they are kept
+ * from one projection to the next when these don't change.
+ */
+static void project_calc_damage(struct project_workspace *ws, int dam, int rad, int flg,
+    byte diameter_of_source)
+{
+    int i;
+    u32b dam_temp;
+    bool dam_const = ((flg & PROJECT_CONST)? true: false);
+
+    if (ws->dam_cached && (ws->dam == dam) && (ws->rad == rad) && (ws->dam_const == dam_const) &&
+        (ws->diameter_of_source == diameter_of_source))
+    {
+        return;
+    }
+
+    for (i = 0; i < ws->dist_size; i++)
+    {
+        /* No damage outside the radius. */
+        if (i > rad)
+            dam_temp = 0;
+
+        /* Effect is constant */
+        else if (dam_const)
+            dam_temp = dam;
+
+        /* Standard damage calc. for 10' source diameters, or at origin. */
+        else if (!diameter_of_source || (i == 0))
+            dam_temp = (dam + i) / (i + 1);
+
+        /*
+         * If a particular diameter for the source of the explosion's energy is
+         * given, it is full strength to that diameter and then reduces.
+         */
+        else
+        {
+            dam_temp = (diameter_of_source * dam) / (i + 1);
+            if (dam_temp > (u32b)dam) dam_temp = dam;
+        }
+
+        /* Store it. */
+        ws->dam_at_dist[i] = dam_temp;
+    }
+
+    ws->dam_cached = true;
+    ws->dam = dam;
+    ws->rad = rad;
+    ws->dam_const = dam_const;
+    ws->diameter_of_source = diameter_of_source;
+}
+
+
+/*
+ * Sort the blast grids by distance from the centre.
+ *
+ * Distances range from 0 to the radius, so a counting sort is used. It keeps grids at
+ * the same distance in the order they were collected.
+ */
+static void project_sort_grids(struct project_workspace *ws, int num_grids, int rad)
+{
+    int i, pos = 0;
+    struct loc *tmp_grid;
+    int *tmp_distance;
+
+    /* Count the grids at each distance */
+    for (i = 0; i <= rad; i++) ws->dist_count[i] = 0;
+    for (i = 0; i < num_grids; i++) ws->dist_count[ws->distance_to_grid[i]]++;
+
+    /* Turn the counts into the position of the first grid at each distance */
+    for (i = 0; i <= rad; i++)
+    {
+        int count = ws->dist_count[i];
+
+        ws->dist_count[i] = pos;
+        pos += count;
+    }
+
+    /* Place each grid */
+    for (i = 0; i < num_grids; i++)
+    {
+        int dist = ws->distance_to_grid[i];
+
+        pos = ws->dist_count[dist]++;
+        loc_copy(&ws->sorted_grid[pos], &ws->blast_grid[i]);
+        ws->sorted_distance[pos] = dist;
+    }
+
+    /* Swap the buffers */
+    tmp_grid = ws->blast_grid;
+    ws->blast_grid = ws->sorted_grid;
+    ws->sorted_grid = tmp_grid;
+    tmp_distance = ws->distance_to_grid;
+    ws->distance_to_grid = ws->sorted_distance;
+    ws->sorted_distance = tmp_distance;
+}
+
+
+/*
+ * Free the projection workspaces
+ */
+static void cleanup_project(void)
+{
+    int i;
+
+    for (i = 0; i < num_workspaces; i++)
+    {
+        struct project_workspace *ws = workspaces[i];
+
+        mem_free(ws->path_grid);
+        mem_free(ws->blast_grid);
+        mem_free(ws->distance_to_grid);
+        mem_free(ws->sorted_grid);
+        mem_free(ws->sorted_distance);
+        mem_free(ws->dist_count);
+        mem_free(ws->dam_at_dist);
+        mem_free(ws);
+    }
+    mem_free(workspaces);
+    workspaces = NULL;
+    num_workspaces = 0;
+}
+
+
+struct init_module project_module =
+{
+    "project",
+    NULL,
+    cleanup_project
+};
+
+
 /*
  * Generic "beam"/"bolt"/"ball" projection routine.
  *
@@ -626,10 +1000,9 @@ void origin_get_loc(struct loc *ploc, struct source *origin)
  *
  * Usage and graphics notes:
  *
- * Only 256 grids can be affected per projection, limiting the effective 
- * radius of standard ball attacks to nine units (diameter nineteen). Arcs
- * can have larger radii; an arc capable of going out to range 20 should not 
- * be wider than 70 degrees.
+ * There is no limit to the number of grids affected by a projection: the
+ * scratch buffers (see struct project_workspace) grow as needed. Arcs
+ * are still limited to a radius of 20.
  *
  * Balls must explode BEFORE hitting walls, or they would affect monsters on 
  * both sides of a wall. 
@@ -651,8 +1024,7 @@ void origin_get_loc(struct loc *ploc, struct source *origin)
 bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finish, int dam, int typ,
     int flg, int degrees_of_arc, byte diameter_of_source, const char *what)
 {
-    int i, j, k, dist_from_centre;
-    u32b dam_temp;
+    int i, j, dist_from_centre;
     struct loc centre;
     struct loc start;
     int n1y = 0;
@@ -662,28 +1034,34 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
     bool notice = false;
 
     /* Notify the UI if it can draw this projection */
-    bool drawing[MAX_PLAYERS];
+    bitflag drawing[DRAWING_SIZE];
 
     /* Number of grids in the "path" */
     int num_path_grids = 0;
 
     /* Actual grids in the "path" */
-    struct loc path_grid[512];
+    struct loc *path_grid;
 
     /* Number of grids in the "blast area" (including the "beam" path) */
     int num_grids = 0;
 
     /* Coordinates of the affected grids */
-    struct loc blast_grid[256];
+    struct loc *blast_grid;
 
     /* Distance to each of the affected grids. */
-    int distance_to_grid[256];
+    int *distance_to_grid;
 
     /* Precalculated damage values for each distance. */
-    int *dam_at_dist = malloc((z_info->max_range + 1) * sizeof(*dam_at_dist));
+    int *dam_at_dist;
+
+    /* Scratch buffers */
+    struct project_workspace *ws = project_workspace_acquire();
+
+    project_workspace_reserve(ws, z_info->max_range, rad);
+    path_grid = ws->path_grid;
 
     /* Assume the player has seen nothing */
-    for (i = 0; i < MAX_PLAYERS; ++i) drawing[i] = false;
+    flag_wipe(drawing, DRAWING_SIZE);
 
     /* No projection path - jump to target */
     if (flg & PROJECT_JUMP)
@@ -726,11 +1104,8 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
      */
     if (loc_eq(&start, finish))
     {
-        loc_copy(&blast_grid[num_grids], finish);
+        project_add_grid(ws, &num_grids, cv, finish, 0);
         loc_copy(&centre, finish);
-        distance_to_grid[num_grids] = 0;
-        sqinfo_on(square(cv, finish)->info, SQUARE_PROJECT);
-        num_grids++;
     }
     else
     {
@@ -776,18 +1151,12 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
                  */
                 if (flg & PROJECT_BEAM)
                 {
-                    loc_copy(&blast_grid[num_grids], &grid);
-                    distance_to_grid[num_grids] = 0;
-                    sqinfo_on(square(cv, &grid)->info, SQUARE_PROJECT);
-                    num_grids++;
+                    project_add_grid(ws, &num_grids, cv, &grid, 0);
                     collected = true;
                 }
                 else if (i == num_path_grids - 1)
                 {
-                    loc_copy(&blast_grid[num_grids], &grid);
-                    distance_to_grid[num_grids] = 0;
-                    sqinfo_on(square(cv, &grid)->info, SQUARE_PROJECT);
-                    num_grids++;
+                    project_add_grid(ws, &num_grids, cv, &grid, 0);
                     collected = true;
                 }
 
@@ -809,13 +1178,7 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
                 if ((flg & PROJECT_STOP) && stop_project(origin, &grid, cv, typ))
                 {
                     /* Store the grid if necessary */
-                    if (!collected)
-                    {
-                        loc_copy(&blast_grid[num_grids], &grid);
-                        distance_to_grid[num_grids] = 0;
-                        sqinfo_on(square(cv, &grid)->info, SQUARE_PROJECT);
-                        num_grids++;
-                    }
+                    if (!collected) project_add_grid(ws, &num_grids, cv, &grid, 0);
 
                     break;
                 }
@@ -857,13 +1220,7 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
         }
 
         /* If the center of the explosion hasn't been saved already, save it now. */
-        if (num_grids == 0)
-        {
-            loc_copy(&blast_grid[num_grids], &centre);
-            distance_to_grid[num_grids] = 0;
-            sqinfo_on(square(cv, &centre)->info, SQUARE_PROJECT);
-            num_grids++;
-        }
+        if (num_grids == 0) project_add_grid(ws, &num_grids, cv, &centre, 0);
 
         loc_init(&begin, centre.x - rad, centre.y - rad);
         loc_init(&end, centre.x + rad, centre.y + rad);
@@ -880,9 +1237,6 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
             /* Center grid has already been stored. */
             if (loc_eq(&iter.cur, &centre)) continue;
 
-            /* Precaution: Stay within area limit. */
-            if (num_grids >= 255) break;
-
             /* Ignore "illegal" locations */
             if (!square_in_bounds(cv, &iter.cur)) continue;
 
@@ -957,70 +1311,19 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
 
             /* Accept remaining grids if in LOS or on the projection path */
             if (los(cv, &centre, &iter.cur) || on_path)
-            {
-                loc_copy(&blast_grid[num_grids], &iter.cur);
-                distance_to_grid[num_grids] = dist_from_centre;
-                sqinfo_on(square(cv, &iter.cur)->info, SQUARE_PROJECT);
-                num_grids++;
-            }
+                project_add_grid(ws, &num_grids, cv, &iter.cur, dist_from_centre);
         }
         while (loc_iterator_next(&iter));
     }
 
     /* Calculate and store the actual damage at each distance. */
-    for (i = 0; i <= z_info->max_range; i++)
-    {
-        /* No damage outside the radius. */
-        if (i > rad)
-            dam_temp = 0;
-
-        /* Effect is constant */
-        else if (flg & PROJECT_CONST)
-            dam_temp = dam;
-
-        /* Standard damage calc. for 10' source diameters, or at origin. */
-        else if (!diameter_of_source || (i == 0))
-            dam_temp = (dam + i) / (i + 1);
-
-        /*
-         * If a particular diameter for the source of the explosion's energy is
-         * given, it is full strength to that diameter and then reduces.
-         */
-        else
-        {
-            dam_temp = (diameter_of_source * dam) / (i + 1);
-            if (dam_temp > (u32b)dam) dam_temp = dam;
-        }
-
-        /* Store it. */
-        dam_at_dist[i] = dam_temp;
-    }
+    project_calc_damage(ws, dam, rad, flg, diameter_of_source);
+    dam_at_dist = ws->dam_at_dist;
 
     /* Sort the blast grids by distance from the centre. */
-    for (i = 0, k = 0; i <= rad; i++)
-    {
-        /* Collect all the grids of a given distance together. */
-        for (j = k; j < num_grids; j++)
-        {
-            if (distance_to_grid[j] == i)
-            {
-                struct loc tmp;
-                int tmp_d;
-
-                loc_copy(&tmp, &blast_grid[k]);
-                tmp_d = distance_to_grid[k];
-
-                loc_copy(&blast_grid[k], &blast_grid[j]);
-                distance_to_grid[k] = distance_to_grid[j];
-
-                loc_copy(&blast_grid[j], &tmp);
-                distance_to_grid[j] = tmp_d;
-
-                /* Write to next slot */
-                k++;
-            }
-        }
-    }
+    project_sort_grids(ws, num_grids, rad);
+    blast_grid = ws->blast_grid;
+    distance_to_grid = ws->distance_to_grid;
 
     /* Display the blast area if allowed. */
     if (!(flg & PROJECT_HIDE))
@@ -1046,7 +1349,7 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
         if (p->timed[TMD_BLIND]) continue;
 
         /* Add one to the count */
-        if (drawing[j]) p->did_visuals = true;
+        if (flag_has(drawing, DRAWING_SIZE, j)) p->did_visuals = true;
     }
 
     /* Affect objects on every relevant grid */
@@ -1198,7 +1501,7 @@ bool project(struct source *origin, int rad, struct chunk *cv, struct loc *finis
         sqinfo_off(square(cv, &blast_grid[i])->info, SQUARE_PROJECT);
     }
 
-    free(dam_at_dist);
+    project_workspace_release();
 
     /* Return "something was noticed" */
     return (notice);
@@ -86,6 +86,8 @@ extern int proj_name_to_idx(const char *name);
 extern const char *proj_idx_to_name(int type);
 extern int project_path(struct player *p, struct loc *gp, int range, struct chunk *c,
     struct loc *grid1, struct loc *grid2, int flg);
+extern void los_memo_reset(struct chunk *c);
+extern void los_memo_free(struct chunk *c);
 extern bool projectable(struct player *p, struct chunk *c, struct loc *grid1, struct loc *grid2,
     int flg, bool nowall);
 extern byte proj_color(int type);
@@ -642,6 +642,9 @@ void wr_stores(void *unused)
         struct store *store = &stores[i];
 
         wr_store(store);
+
+        /* Save the missed maintenance passes */
+        wr_s16b(store->maint_pending);
     }
 
     /* Note the store orders */
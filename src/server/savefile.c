@@ -139,7 +139,7 @@ static const savefile_saver server_savers[] =
     {"object memory", wr_object_memory, 1},
     {"misc", wr_misc, 1},
     {"artifacts", wr_artifacts, 1},
-    {"stores", wr_stores, 1},
+    {"stores", wr_stores, 2},
     {"dungeons", wr_dungeon, 1},
     {"objects", wr_objects, 1},
     {"monsters", wr_monsters, 1},
@@ -205,7 +205,8 @@ static const struct blockinfo server_loaders[] =
     {"object memory", rd_object_memory, 1},
     {"misc", rd_misc, 1},
     {"artifacts", rd_artifacts, 1},
-    {"stores", rd_stores, 1},
+    {"stores", rd_stores_1, 1},
+    {"stores", rd_stores, 2},
     {"dungeons", rd_dungeon, 1},
     {"objects", rd_objects, 1},
     {"monsters", rd_monsters, 1},
@@ -55,6 +55,7 @@ extern int rd_artifacts(struct player *unused);
 extern int rd_player_hp(struct player *p);
 extern int rd_player_spells(struct player *p);
 extern int rd_gear(struct player *p);
+extern int rd_stores_1(struct player *unused);
 extern int rd_stores(struct player *unused);
 extern int rd_player_dungeon(struct player *p);
 extern int rd_level(struct player *unused);
@@ -1576,8 +1576,45 @@ static void store_maint(struct store *s, bool force)
 }
 
 
+/*
+ * Check if a store is only maintained when a player walks in (see store_catch_up()).
+ *
+ * This is limited to plain turnover stores. The black markets also destroy items which fail
+ * black_market_ok() and the XBM keeps ordered items, and stores without turnover only sell
+ * their stock without replacing it, so these are still maintained on the world clock.
+ */
+static bool store_maint_deferred(struct store *s)
+{
+    return (s->turnover && !store_black_market(s));
+}
+
+
+/*
+ * Number of maintenance passes after which a deferred store is statistically the same as if
+ * every pass had been run.
+ *
+ * In a plain turnover store, each pass removes randint1(turnover) slots (or all of them) by
+ * picking slots at random, a picked slot being removed wholly at least 1 time out of 4. It
+ * then tops up the staples, which are always the same, and restocks with new random items,
+ * which do not depend on the old stock. After the first pass, the store holds at most
+ * S = normal_stock_max + always_num slots, so a given slot is removed during a pass with a
+ * probability of at least (turnover + 1) / (8 * S). After 40 * S / (turnover + 1) passes,
+ * the chance that any part of the old stock is still there is below exp(-5) (less than 1%):
+ * the result of the remaining passes is then independent of the stock the store had.
+ */
+static int store_maint_limit(struct store *s)
+{
+    int slots = s->normal_stock_max + s->always_num;
+
+    return MAX(10, 40 * slots / (s->turnover + 1));
+}
+
+
 /*
  * Update the stores.
+ *
+ * Plain turnover stores are not maintained on the world clock: the missed passes are counted
+ * and applied when a player enters the store (see store_catch_up()).
  */
 void store_update(void)
 {
@@ -1585,13 +1622,19 @@ void store_update(void)
     {
         int n;
 
-        /* Maintain each shop (except home) */
+        /* Maintain each shop (except tavern, home and player store) */
         for (n = 0; n < store_max; n++)
         {
             struct store *store = &stores[n];
 
-            /* Skip the home */
-            if (store->type == STORE_HOME) continue;
+            if (store->type >= STORE_TAVERN) continue;
+
+            /* Count a missed pass (more would not change the result) */
+            if (store_maint_deferred(store))
+            {
+                if (store->maint_pending < store_maint_limit(store)) store->maint_pending++;
+                continue;
+            }
 
             /* Maintain */
             store_maint(store, false);
@@ -1603,13 +1646,41 @@ void store_update(void)
             /* Pick a random shop (except tavern, home and player store) */
             n = randint0(store_max - 3);
 
-            /* Shuffle it */
-            store_shuffle(&stores[n], false);
+            /* Shuffle it (deferred stores draw their shuffles when a player walks in) */
+            if (!store_maint_deferred(&stores[n])) store_shuffle(&stores[n], false);
         }
     }
 }
 
 
+/*
+ * Apply the maintenance passes a store has missed since it was last visited.
+ *
+ * At most store_maint_limit() passes are counted, which gives a statistically identical
+ * store (see there). The owner is shuffled once with the chance of at least one shuffle
+ * during the missed passes.
+ */
+static void store_catch_up(struct store *s)
+{
+    int passes = s->maint_pending;
+
+    if (!passes) return;
+
+    /* Sometimes, shuffle the shopkeeper (except tavern, home and player store) */
+    if (s->sidx < store_max - 3)
+    {
+        double keep = pow(1.0 - 1.0 / (z_info->store_shuffle * (store_max - 3)), passes);
+
+        if (randint0(10000) >= (int)(10000 * keep)) store_shuffle(s, true);
+    }
+
+    /* Maintain */
+    while (passes--) store_maint(s, true);
+
+    s->maint_pending = 0;
+}
+
+
 /** Owner stuff **/
 
 
@@ -1994,60 +2065,37 @@ static int display_inventory(struct player *p)
  */
 static int display_live_inventory(struct player *p)
 {
-    int stocked;
-    struct loc_iterator iter;
+    int stocked = 0;
+    struct house_listing *item;
 
     /* Send a "live" inventory */
-    struct house_type *h_ptr = house_get(p->player_store_num);
-    struct chunk *c = chunk_get(&h_ptr->wpos);
-
-    loc_iterator_first(&iter, &h_ptr->grid_1, &h_ptr->grid_2);
-
-    /* Scan house */
-    stocked = 0;
-    do
+    for (item = house_stock_get(p->player_store_num); item; item = item->next)
     {
-        struct object *obj, *copy;
-
-        /* Scan all objects in the grid */
-        for (obj = square_object(c, &iter.cur); obj; obj = obj->next)
-        {
-            /* Must be for sale */
-            if (!obj->note) continue;
+        /* Get a copy of the object */
+        struct object *copy = object_new();
 
-            /* Get a copy of the object */
-            copy = object_new();
-            object_copy(copy, obj);
+        object_copy(copy, item->obj);
 
-            /* Set ask price */
-            copy->askprice = 0;
-            if (set_askprice(copy))
-            {
-                /* Know everything but flavor, no origin yet */
-                object_notice_everything_aux(p, copy, true, false);
+        /* Set ask price */
+        copy->askprice = item->askprice;
 
-                /* Hack -- set index */
-                copy->oidx = stocked;
+        /* Know everything but flavor, no origin yet */
+        object_notice_everything_aux(p, copy, true, false);
 
-                /* Remove any inscription */
-                copy->note = 0;
+        /* Hack -- set index */
+        copy->oidx = stocked;
 
-                /* Display that line */
-                display_entry(p, copy, false);
-                stocked++;
+        /* Remove any inscription */
+        copy->note = 0;
 
-                /* Limited space available */
-                if (stocked == z_info->store_inven_max)
-                {
-                    object_delete(&copy);
-                    return stocked;
-                }
-            }
+        /* Display that line */
+        display_entry(p, copy, false);
+        stocked++;
+        object_delete(&copy);
 
-            object_delete(&copy);
-        }
+        /* Limited space available */
+        if (stocked == z_info->store_inven_max) break;
     }
-    while (loc_iterator_next(&iter));
 
     return stocked;
 }
@@ -2224,44 +2272,32 @@ static void display_store(struct player *p, bool entering)
 static struct object *player_store_object(struct player *p, int item, struct object **original)
 {
     int stocked = 0;
-    struct loc_iterator iter;
-    struct house_type *h_ptr = house_get(p->player_store_num);
-    struct chunk *c = chunk_get(&h_ptr->wpos);
-
-    loc_iterator_first(&iter, &h_ptr->grid_1, &h_ptr->grid_2);
+    struct house_listing *listing;
 
     /* Scan the store to find the item */
-    do
+    for (listing = house_stock_get(p->player_store_num); listing; listing = listing->next)
     {
-        /* Scan all objects in the grid */
-        for (*original = square_object(c, &iter.cur); *original; *original = (*original)->next)
+        /* Is this the item we are looking for? */
+        if (item == stocked)
         {
-            struct object *obj;
-
-            /* Must be for sale */
-            if (!(*original)->note) continue;
+            struct object *obj = object_new();
 
             /* Get a copy of the object */
-            obj = object_new();
+            *original = listing->obj;
             object_copy(obj, *original);
 
             /* Set ask price */
-            obj->askprice = 0;
-            if (set_askprice(obj))
-            {
-                /* Is this the item we are looking for? */
-                if (item == stocked) return obj;
-
-                /* Keep looking */
-                stocked++;
-            }
+            obj->askprice = listing->askprice;
 
-            object_delete(&obj);
+            return obj;
         }
+
+        /* Keep looking */
+        stocked++;
     }
-    while (loc_iterator_next(&iter));
 
     /* If we didn't find this item, something has gone badly wrong */
+    *original = NULL;
     msg(p, "Sorry, this item is reserved.");
 
     return NULL;
@@ -2294,6 +2330,7 @@ static void sell_player_item(struct player *p, struct object *original, struct o
 
         /* Reduce the pile of items */
         original->number -= bought->number;
+        house_stock_changed(&h_ptr->wpos, &original->grid);
     }
 
     /* Extract the price for the stack that has been sold */
@@ -3178,6 +3215,9 @@ void do_cmd_store(struct player *p, int pstore)
             }
         }
 
+        /* Catch up with the missed maintenance */
+        store_catch_up(&stores[which]);
+
         /* Save the store number */
         p->store_num = which;
 
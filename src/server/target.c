@@ -178,8 +178,9 @@ bool target_okay(struct player *p)
     /* Check "monster" targets */
     if (target_who->monster)
     {
-        /* Accept reasonable targets */
-        if (target_able(p, target_who))
+        /* Accept reasonable targets (not a new monster in the slot of a dead one) */
+        if ((target_who->monster->generation == p->target.target_gen) &&
+            target_able(p, target_who))
         {
             /* Get the monster location */
             loc_copy(&p->target.grid, &target_who->monster->grid);
@@ -219,6 +220,7 @@ bool target_set_monster(struct player *p, struct source *who)
         /* Save target info */
         p->target.target_set = true;
         memcpy(&p->target.target_who, who, sizeof(struct source));
+        p->target.target_gen = (who->monster? who->monster->generation: 0);
         if (who->monster)
             loc_copy(&p->target.grid, &who->monster->grid);
         else
@@ -263,7 +265,10 @@ void target_set_location(struct player *p, struct loc *grid)
         p->target.target_set = true;
         memset(&p->target.target_who, 0, sizeof(struct source));
         if (target_able(p, who))
+        {
             memcpy(&p->target.target_who, who, sizeof(struct source));
+            p->target.target_gen = (who->monster? who->monster->generation: 0);
+        }
         loc_copy(&p->target.grid, grid);
 
         return;
@@ -297,7 +302,9 @@ void target_release(struct player *p)
         struct monster *mon = p->old_target.target_who.monster;
         struct player *player = p->old_target.target_who.player;
 
-        if ((mon && (!mon->race || !monster_is_in_view(p, mon->midx))) || (player && player->is_dead))
+        /* The slot of a dead monster may have been reused by a new one */
+        if ((mon && (!mon->race || (mon->generation != p->old_target.target_gen) ||
+            !monster_is_in_view(p, mon->midx))) || (player && player->is_dead))
             loc_init(&p->target.grid, 0, 0);
     }
 }
@@ -551,13 +558,68 @@ bool panel_contains(struct player *p, struct loc *grid)
 }
 
 
+/*
+ * Check if a grid should be part of a target set
+ */
+static bool target_set_accept(struct player *p, struct chunk *c, struct loc *grid, int mode)
+{
+    int feat;
+    struct source who_body;
+    struct source *who = &who_body;
+
+    /* Check bounds */
+    if (!square_in_bounds_fully(c, grid)) return false;
+
+    /* Require line of sight */
+    if (!square_isview(p, grid)) return false;
+
+    /* Require "interesting" contents */
+    if (!target_accept(p, grid)) return false;
+
+    feat = square(c, grid)->feat;
+    square_actor(c, grid, who);
+
+    /* Special modes */
+    if (mode & (TARGET_KILL))
+    {
+        /* Must be a targetable monster (or player) */
+        if (!target_able(p, who)) return false;
+
+        /* Skip non hostile monsters */
+        if (who->monster && !pvm_check(p, who->monster)) return false;
+
+        /* Don't target yourself */
+        if (who->player && (who->player == p)) return false;
+
+        /* Ignore players we aren't hostile to */
+        if (who->player && !pvp_check(p, who->player, PVP_CHECK_BOTH, true, feat))
+            return false;
+    }
+    else if (mode & (TARGET_HELP))
+    {
+        /* Must contain a player */
+        if (!who->player) return false;
+
+        /* Must be a targetable player */
+        if (!target_able(p, who)) return false;
+
+        /* Don't target yourself */
+        if (who->player == p) return false;
+
+        /* Ignore players we aren't friends with */
+        if (pvp_check(p, who->player, PVP_CHECK_BOTH, true, 0x00)) return false;
+    }
+
+    return true;
+}
+
+
 /*
  * Return a target set of target_able monsters.
  */
 struct point_set *target_get_monsters(struct player *p, int mode)
 {
     struct loc begin, end;
-    struct loc_iterator iter;
     int min_y, min_x, max_y, max_x;
     struct point_set *targets = point_set_new(TS_INITIAL_SIZE);
     struct chunk *c = chunk_get(&p->wpos);
@@ -567,62 +629,40 @@ struct point_set *target_get_monsters(struct player *p, int mode)
 
     loc_init(&begin, min_x, min_y);
     loc_init(&end, max_x, max_y);
-    loc_iterator_first(&iter, &begin, &end);
 
-    /* Scan the current panel */
-    do
+    /* Only monsters and players can be targeted: scan the grids holding them */
+    if (mode & (TARGET_KILL | TARGET_HELP))
     {
-        int feat;
-        struct source who_body;
-        struct source *who = &who_body;
-
-        /* Check bounds */
-        if (!square_in_bounds_fully(c, &iter.cur)) continue;
-
-        /* Require line of sight */
-        if (!square_isview(p, &iter.cur)) continue;
-
-        /* Require "interesting" contents */
-        if (!target_accept(p, &iter.cur)) continue;
+        struct actor_iterator iter;
+        struct loc last;
 
-        feat = square(c, &iter.cur)->feat;
-        square_actor(c, &iter.cur, who);
-
-        /* Special modes */
-        if (mode & (TARGET_KILL))
+        loc_init(&last, max_x - 1, max_y - 1);
+        if (actor_iterator_first(&iter, c, &begin, &last))
         {
-            /* Must be a targetable monster (or player) */
-            if (!target_able(p, who)) continue;
-
-            /* Skip non hostile monsters */
-            if (who->monster && !pvm_check(p, who->monster)) continue;
-
-            /* Don't target yourself */
-            if (who->player && (who->player == p)) continue;
-
-            /* Ignore players we aren't hostile to */
-            if (who->player && !pvp_check(p, who->player, PVP_CHECK_BOTH, true, feat))
-                continue;
+            do
+            {
+                /* Save the location */
+                if (target_set_accept(p, c, &iter.cur, mode))
+                    add_to_point_set(targets, p, &iter.cur);
+            }
+            while (actor_iterator_next(&iter, c));
         }
-        else if (mode & (TARGET_HELP))
-        {
-            /* Must contain a player */
-            if (!who->player) continue;
-
-            /* Must be a targetable player */
-            if (!target_able(p, who)) continue;
+    }
 
-            /* Don't target yourself */
-            if (who->player == p) continue;
+    /* Scan the current panel */
+    else
+    {
+        struct loc_iterator iter;
 
-            /* Ignore players we aren't friends with */
-            if (pvp_check(p, who->player, PVP_CHECK_BOTH, true, 0x00)) continue;
+        loc_iterator_first(&iter, &begin, &end);
+        do
+        {
+            /* Save the location */
+            if (target_set_accept(p, c, &iter.cur, mode))
+                add_to_point_set(targets, p, &iter.cur);
         }
-
-        /* Save the location */
-        add_to_point_set(targets, p, &iter.cur);
+        while (loc_iterator_next_strict(&iter));
     }
-    while (loc_iterator_next_strict(&iter));
 
     /* Sort the positions */
     sort(targets->pts, point_set_size(targets), sizeof(*(targets->pts)),